@@ -0,0 +1,624 @@
+# DO NOT EDIT THIS FILE
+# It is autogenerated by make/calcdep.pl, and will be overwritten
+# every time you rerun make in the main directory
+VPATH = $(SOURCEPATH)/src
+
+bad-target:
+	@echo "This Makefile must be run by a sub-make from the source"
+	@echo "in order to set the correct environment variables"
+	@exit 1
+
+all: inspircd coremods modules
+
+obj/bancache.o: bancache.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/bancache.cpp $>
+obj/base.o: base.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/base.cpp $>
+obj/channels.o: channels.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/channels.cpp $>
+obj/cidr.o: cidr.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/cidr.cpp $>
+obj/command_parse.o: command_parse.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/command_parse.cpp $>
+obj/commands.o: commands.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/commands.cpp $>
+obj/configparser.o: configparser.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configparser.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/configparser.cpp $>
+obj/configreader.o: configreader.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configparser.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/configreader.cpp $>
+obj/cull_list.o: cull_list.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/cull_list.cpp $>
+obj/dynamic.o: dynamic.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/dynamic.cpp $>
+obj/filelogger.o: filelogger.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/filelogger.cpp $>
+obj/fileutils.o: fileutils.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/fileutils.cpp $>
+obj/hashcomp.o: hashcomp.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/hashcomp.cpp $>
+obj/helperfuncs.o: helperfuncs.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/helperfuncs.cpp $>
+obj/inspircd.o: inspircd.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/testsuite.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/inspircd.cpp $>
+obj/inspsocket.o: inspsocket.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/inspsocket.cpp $>
+obj/inspstring.o: inspstring.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/inspstring.cpp $>
+obj/iothread.o: iothread.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/iothread.cpp $>
+obj/listensocket.o: listensocket.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/listensocket.cpp $>
+obj/listmode.o: listmode.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/listmode.cpp $>
+obj/logger.o: logger.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/logger.cpp $>
+obj/mode.o: mode.cpp include/aligned_storage.h include/bancache.h include/base.h include/builtinmodes.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/mode.cpp $>
+obj/modmanager_dynamic.o: modmanager_dynamic.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modmanager_dynamic.cpp $>
+obj/modmanager_static.o: modmanager_static.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modmanager_static.cpp $>
+obj/modules.o: modules.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules.cpp $>
+obj/server.o: server.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/server.cpp $>
+obj/snomasks.o: snomasks.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/snomasks.cpp $>
+obj/socket.o: socket.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/socket.cpp $>
+obj/socketengine.o: socketengine.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/socketengine.cpp $>
+obj/testsuite.o: testsuite.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/testsuite.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/testsuite.cpp $>
+obj/threadengine.o: threadengine.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/threadengine.cpp $>
+obj/timer.o: timer.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/timer.cpp $>
+obj/usermanager.o: usermanager.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/usermanager.cpp $>
+obj/users.o: users.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/users.cpp $>
+obj/wildcard.o: wildcard.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/wildcard.cpp $>
+obj/xline.o: xline.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/xline.cpp $>
+obj/cmode_k.o: modes/cmode_k.cpp include/aligned_storage.h include/bancache.h include/base.h include/builtinmodes.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modes/cmode_k.cpp $>
+obj/cmode_l.o: modes/cmode_l.cpp include/aligned_storage.h include/bancache.h include/base.h include/builtinmodes.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modes/cmode_l.cpp $>
+obj/umode_o.o: modes/umode_o.cpp include/aligned_storage.h include/bancache.h include/base.h include/builtinmodes.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modes/umode_o.cpp $>
+obj/umode_s.o: modes/umode_s.cpp include/aligned_storage.h include/bancache.h include/base.h include/builtinmodes.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modes/umode_s.cpp $>
+obj/socketengine_epoll.o: socketengines/socketengine_epoll.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/socketengines/socketengine_epoll.cpp $>
+obj/socketengine_kqueue.o: socketengines/socketengine_kqueue.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/socketengines/socketengine_kqueue.cpp $>
+obj/socketengine_poll.o: socketengines/socketengine_poll.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/socketengines/socketengine_poll.cpp $>
+obj/socketengine_ports.o: socketengines/socketengine_ports.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/socketengines/socketengine_ports.cpp $>
+obj/socketengine_select.o: socketengines/socketengine_select.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/socketengines/socketengine_select.cpp $>
+obj/socketengine_uring.o: socketengines/socketengine_uring.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/socketengines/socketengine_uring.cpp $>
+obj/threadengine_pthread.o: threadengines/threadengine_pthread.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/threadengines/threadengine_pthread.cpp $>
+obj/core_channel/cmd_invite.o: coremods/core_channel/cmd_invite.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_channel/cmd_invite.cpp $>
+obj/core_channel/cmd_join.o: coremods/core_channel/cmd_join.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_channel/cmd_join.cpp $>
+obj/core_channel/cmd_kick.o: coremods/core_channel/cmd_kick.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_channel/cmd_kick.cpp $>
+obj/core_channel/cmd_names.o: coremods/core_channel/cmd_names.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_channel/cmd_names.cpp $>
+obj/core_channel/cmd_topic.o: coremods/core_channel/cmd_topic.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_channel/cmd_topic.cpp $>
+obj/core_channel/core_channel.o: coremods/core_channel/core_channel.cpp coremods/core_channel/core_channel.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_channel/core_channel.cpp $>
+modules/core_channel.so: obj/core_channel/cmd_invite.o obj/core_channel/cmd_join.o obj/core_channel/cmd_kick.o obj/core_channel/cmd_names.o obj/core_channel/cmd_topic.o obj/core_channel/core_channel.o
+	@$(SOURCEPATH)/make/unit-cc.pl link-dir$(VERBOSE) $@ $^ $>
+modules/core_dns.so: coremods/core_dns.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_dns.cpp $>
+modules/core_hostname_lookup.so: coremods/core_hostname_lookup.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_hostname_lookup.cpp $>
+obj/core_info/cmd_admin.o: coremods/core_info/cmd_admin.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_info/cmd_admin.cpp $>
+obj/core_info/cmd_commands.o: coremods/core_info/cmd_commands.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_info/cmd_commands.cpp $>
+obj/core_info/cmd_info.o: coremods/core_info/cmd_info.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_info/cmd_info.cpp $>
+obj/core_info/cmd_modules.o: coremods/core_info/cmd_modules.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_info/cmd_modules.cpp $>
+obj/core_info/cmd_motd.o: coremods/core_info/cmd_motd.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_info/cmd_motd.cpp $>
+obj/core_info/cmd_time.o: coremods/core_info/cmd_time.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_info/cmd_time.cpp $>
+obj/core_info/cmd_version.o: coremods/core_info/cmd_version.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_info/cmd_version.cpp $>
+obj/core_info/core_info.o: coremods/core_info/core_info.cpp coremods/core_info/core_info.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_info/core_info.cpp $>
+modules/core_info.so: obj/core_info/cmd_admin.o obj/core_info/cmd_commands.o obj/core_info/cmd_info.o obj/core_info/cmd_modules.o obj/core_info/cmd_motd.o obj/core_info/cmd_time.o obj/core_info/cmd_version.o obj/core_info/core_info.o
+	@$(SOURCEPATH)/make/unit-cc.pl link-dir$(VERBOSE) $@ $^ $>
+modules/core_ison.so: coremods/core_ison.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_ison.cpp $>
+modules/core_list.so: coremods/core_list.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_list.cpp $>
+modules/core_loadmodule.so: coremods/core_loadmodule.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_loadmodule.cpp $>
+modules/core_lusers.so: coremods/core_lusers.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_lusers.cpp $>
+obj/core_oper/cmd_die.o: coremods/core_oper/cmd_die.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/exitcodes.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_oper/cmd_die.cpp $>
+obj/core_oper/cmd_kill.o: coremods/core_oper/cmd_kill.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_oper/cmd_kill.cpp $>
+obj/core_oper/cmd_oper.o: coremods/core_oper/cmd_oper.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_oper/cmd_oper.cpp $>
+obj/core_oper/cmd_rehash.o: coremods/core_oper/cmd_rehash.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_oper/cmd_rehash.cpp $>
+obj/core_oper/cmd_restart.o: coremods/core_oper/cmd_restart.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_oper/cmd_restart.cpp $>
+obj/core_oper/core_oper.o: coremods/core_oper/core_oper.cpp coremods/core_oper/core_oper.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_oper/core_oper.cpp $>
+modules/core_oper.so: obj/core_oper/cmd_die.o obj/core_oper/cmd_kill.o obj/core_oper/cmd_oper.o obj/core_oper/cmd_rehash.o obj/core_oper/cmd_restart.o obj/core_oper/core_oper.o
+	@$(SOURCEPATH)/make/unit-cc.pl link-dir$(VERBOSE) $@ $^ $>
+modules/core_privmsg.so: coremods/core_privmsg.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_privmsg.cpp $>
+modules/core_reloadmodule.so: coremods/core_reloadmodule.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_reloadmodule.cpp $>
+modules/core_stats.so: coremods/core_stats.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_stats.cpp $>
+modules/core_stub.so: coremods/core_stub.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_stub.cpp $>
+obj/core_user/cmd_away.o: coremods/core_user/cmd_away.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_user/cmd_away.cpp $>
+obj/core_user/cmd_mode.o: coremods/core_user/cmd_mode.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_user/cmd_mode.cpp $>
+obj/core_user/cmd_nick.o: coremods/core_user/cmd_nick.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_user/cmd_nick.cpp $>
+obj/core_user/cmd_part.o: coremods/core_user/cmd_part.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_user/cmd_part.cpp $>
+obj/core_user/cmd_quit.o: coremods/core_user/cmd_quit.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_user/cmd_quit.cpp $>
+obj/core_user/cmd_user.o: coremods/core_user/cmd_user.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_user/cmd_user.cpp $>
+obj/core_user/core_user.o: coremods/core_user/core_user.cpp coremods/core_user/core_user.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_user/core_user.cpp $>
+modules/core_user.so: obj/core_user/cmd_away.o obj/core_user/cmd_mode.o obj/core_user/cmd_nick.o obj/core_user/cmd_part.o obj/core_user/cmd_quit.o obj/core_user/cmd_user.o obj/core_user/core_user.o
+	@$(SOURCEPATH)/make/unit-cc.pl link-dir$(VERBOSE) $@ $^ $>
+modules/core_userhost.so: coremods/core_userhost.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_userhost.cpp $>
+modules/core_wallops.so: coremods/core_wallops.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_wallops.cpp $>
+modules/core_who.so: coremods/core_who.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_who.cpp $>
+modules/core_whois.so: coremods/core_whois.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_whois.cpp $>
+modules/core_whowas.so: coremods/core_whowas.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/commands/cmd_whowas.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_whowas.cpp $>
+obj/core_xline/cmd_eline.o: coremods/core_xline/cmd_eline.cpp coremods/core_xline/core_xline.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_xline/cmd_eline.cpp $>
+obj/core_xline/cmd_gline.o: coremods/core_xline/cmd_gline.cpp coremods/core_xline/core_xline.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_xline/cmd_gline.cpp $>
+obj/core_xline/cmd_kline.o: coremods/core_xline/cmd_kline.cpp coremods/core_xline/core_xline.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_xline/cmd_kline.cpp $>
+obj/core_xline/cmd_qline.o: coremods/core_xline/cmd_qline.cpp coremods/core_xline/core_xline.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_xline/cmd_qline.cpp $>
+obj/core_xline/cmd_zline.o: coremods/core_xline/cmd_zline.cpp coremods/core_xline/core_xline.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_xline/cmd_zline.cpp $>
+obj/core_xline/core_xline.o: coremods/core_xline/core_xline.cpp coremods/core_xline/core_xline.h include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/coremods/core_xline/core_xline.cpp $>
+modules/core_xline.so: obj/core_xline/cmd_eline.o obj/core_xline/cmd_gline.o obj/core_xline/cmd_kline.o obj/core_xline/cmd_qline.o obj/core_xline/cmd_zline.o obj/core_xline/core_xline.o
+	@$(SOURCEPATH)/make/unit-cc.pl link-dir$(VERBOSE) $@ $^ $>
+modules/m_abbreviation.so: modules/m_abbreviation.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_abbreviation.cpp $>
+modules/m_alias.so: modules/m_alias.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_alias.cpp $>
+modules/m_allowinvite.so: modules/m_allowinvite.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_allowinvite.cpp $>
+modules/m_alltime.so: modules/m_alltime.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_alltime.cpp $>
+modules/m_auditorium.so: modules/m_auditorium.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_auditorium.cpp $>
+modules/m_autoop.so: modules/m_autoop.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_autoop.cpp $>
+modules/m_banexception.so: modules/m_banexception.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_banexception.cpp $>
+modules/m_banredirect.so: modules/m_banredirect.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_banredirect.cpp $>
+modules/m_bcrypt.so: modules/m_bcrypt.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/hash.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_bcrypt.cpp $>
+modules/m_blockamsg.so: modules/m_blockamsg.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_blockamsg.cpp $>
+modules/m_blockcaps.so: modules/m_blockcaps.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_blockcaps.cpp $>
+modules/m_blockcolor.so: modules/m_blockcolor.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_blockcolor.cpp $>
+modules/m_botmode.so: modules/m_botmode.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_botmode.cpp $>
+modules/m_callerid.so: modules/m_callerid.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_callerid.cpp $>
+modules/m_cap.so: modules/m_cap.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/cap.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_cap.cpp $>
+modules/m_cban.so: modules/m_cban.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_cban.cpp $>
+modules/m_censor.so: modules/m_censor.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_censor.cpp $>
+modules/m_cgiirc.so: modules/m_cgiirc.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_cgiirc.cpp $>
+modules/m_chancreate.so: modules/m_chancreate.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_chancreate.cpp $>
+modules/m_chanfilter.so: modules/m_chanfilter.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_chanfilter.cpp $>
+modules/m_chanhistory.so: modules/m_chanhistory.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_chanhistory.cpp $>
+modules/m_chanlog.so: modules/m_chanlog.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_chanlog.cpp $>
+modules/m_channames.so: modules/m_channames.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_channames.cpp $>
+modules/m_channelban.so: modules/m_channelban.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_channelban.cpp $>
+modules/m_check.so: modules/m_check.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_check.cpp $>
+modules/m_chghost.so: modules/m_chghost.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_chghost.cpp $>
+modules/m_chgident.so: modules/m_chgident.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_chgident.cpp $>
+modules/m_chgname.so: modules/m_chgname.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_chgname.cpp $>
+modules/m_clearchan.so: modules/m_clearchan.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_clearchan.cpp $>
+modules/m_cloaking.so: modules/m_cloaking.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/hash.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_cloaking.cpp $>
+modules/m_clones.so: modules/m_clones.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_clones.cpp $>
+modules/m_close.so: modules/m_close.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_close.cpp $>
+modules/m_commonchans.so: modules/m_commonchans.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_commonchans.cpp $>
+modules/m_conn_join.so: modules/m_conn_join.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_conn_join.cpp $>
+modules/m_conn_umodes.so: modules/m_conn_umodes.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_conn_umodes.cpp $>
+modules/m_conn_waitpong.so: modules/m_conn_waitpong.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_conn_waitpong.cpp $>
+modules/m_connectban.so: modules/m_connectban.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_connectban.cpp $>
+modules/m_connflood.so: modules/m_connflood.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_connflood.cpp $>
+modules/m_customprefix.so: modules/m_customprefix.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_customprefix.cpp $>
+modules/m_customtitle.so: modules/m_customtitle.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_customtitle.cpp $>
+modules/m_cycle.so: modules/m_cycle.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_cycle.cpp $>
+modules/m_dccallow.so: modules/m_dccallow.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_dccallow.cpp $>
+modules/m_deaf.so: modules/m_deaf.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_deaf.cpp $>
+modules/m_delayjoin.so: modules/m_delayjoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_delayjoin.cpp $>
+modules/m_delaymsg.so: modules/m_delaymsg.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_delaymsg.cpp $>
+modules/m_denychans.so: modules/m_denychans.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_denychans.cpp $>
+modules/m_devoice.so: modules/m_devoice.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_devoice.cpp $>
+modules/m_dnsbl.so: modules/m_dnsbl.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_dnsbl.cpp $>
+modules/m_exemptchanops.so: modules/m_exemptchanops.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_exemptchanops.cpp $>
+modules/m_filter.so: modules/m_filter.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/regex.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_filter.cpp $>
+modules/m_flashpolicyd.so: modules/m_flashpolicyd.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_flashpolicyd.cpp $>
+modules/m_gecosban.so: modules/m_gecosban.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_gecosban.cpp $>
+modules/m_globalload.so: modules/m_globalload.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_globalload.cpp $>
+modules/m_globops.so: modules/m_globops.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_globops.cpp $>
+modules/m_helpop.so: modules/m_helpop.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_helpop.cpp $>
+modules/m_hidechans.so: modules/m_hidechans.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_hidechans.cpp $>
+modules/m_hidelist.so: modules/m_hidelist.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_hidelist.cpp $>
+modules/m_hideoper.so: modules/m_hideoper.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_hideoper.cpp $>
+modules/m_hostchange.so: modules/m_hostchange.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_hostchange.cpp $>
+modules/m_hostcycle.so: modules/m_hostcycle.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_hostcycle.cpp $>
+modules/m_httpd.so: modules/m_httpd.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/httpd.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_httpd.cpp $>
+modules/m_httpd_acl.so: modules/m_httpd_acl.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/httpd.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_httpd_acl.cpp $>
+modules/m_httpd_config.so: modules/m_httpd_config.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/httpd.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_httpd_config.cpp $>
+modules/m_httpd_stats.so: modules/m_httpd_stats.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/httpd.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_httpd_stats.cpp $>
+modules/m_ident.so: modules/m_ident.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_ident.cpp $>
+modules/m_inviteexception.so: modules/m_inviteexception.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_inviteexception.cpp $>
+modules/m_ircv3.so: modules/m_ircv3.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/account.h include/modules/cap.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_ircv3.cpp $>
+modules/m_joinflood.so: modules/m_joinflood.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_joinflood.cpp $>
+modules/m_jumpserver.so: modules/m_jumpserver.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/ssl.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_jumpserver.cpp $>
+modules/m_kicknorejoin.so: modules/m_kicknorejoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_kicknorejoin.cpp $>
+modules/m_knock.so: modules/m_knock.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_knock.cpp $>
+modules/m_ldapauth.so: modules/m_ldapauth.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/ldap.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_ldapauth.cpp $>
+modules/m_ldapoper.so: modules/m_ldapoper.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/ldap.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_ldapoper.cpp $>
+modules/m_lockserv.so: modules/m_lockserv.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_lockserv.cpp $>
+modules/m_maphide.so: modules/m_maphide.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_maphide.cpp $>
+modules/m_md5.so: modules/m_md5.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/hash.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_md5.cpp $>
+modules/m_messageflood.so: modules/m_messageflood.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_messageflood.cpp $>
+modules/m_mlock.so: modules/m_mlock.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_mlock.cpp $>
+modules/m_modenotice.so: modules/m_modenotice.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_modenotice.cpp $>
+modules/m_muteban.so: modules/m_muteban.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_muteban.cpp $>
+modules/m_namedmodes.so: modules/m_namedmodes.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_namedmodes.cpp $>
+modules/m_namesx.so: modules/m_namesx.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/cap.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_namesx.cpp $>
+modules/m_nationalchars.so: modules/m_nationalchars.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_nationalchars.cpp $>
+modules/m_nickflood.so: modules/m_nickflood.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_nickflood.cpp $>
+modules/m_nicklock.so: modules/m_nicklock.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_nicklock.cpp $>
+modules/m_noctcp.so: modules/m_noctcp.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_noctcp.cpp $>
+modules/m_nokicks.so: modules/m_nokicks.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_nokicks.cpp $>
+modules/m_nonicks.so: modules/m_nonicks.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_nonicks.cpp $>
+modules/m_nonotice.so: modules/m_nonotice.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_nonotice.cpp $>
+modules/m_nopartmsg.so: modules/m_nopartmsg.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_nopartmsg.cpp $>
+modules/m_ojoin.so: modules/m_ojoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_ojoin.cpp $>
+modules/m_operchans.so: modules/m_operchans.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_operchans.cpp $>
+modules/m_operjoin.so: modules/m_operjoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_operjoin.cpp $>
+modules/m_operlevels.so: modules/m_operlevels.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_operlevels.cpp $>
+modules/m_operlog.so: modules/m_operlog.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_operlog.cpp $>
+modules/m_opermodes.so: modules/m_opermodes.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_opermodes.cpp $>
+modules/m_opermotd.so: modules/m_opermotd.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_opermotd.cpp $>
+modules/m_operprefix.so: modules/m_operprefix.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_operprefix.cpp $>
+modules/m_override.so: modules/m_override.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_override.cpp $>
+modules/m_passforward.so: modules/m_passforward.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_passforward.cpp $>
+modules/m_password_hash.so: modules/m_password_hash.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/hash.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_password_hash.cpp $>
+modules/m_pbkdf2.so: modules/m_pbkdf2.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/hash.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_pbkdf2.cpp $>
+modules/m_permchannels.so: modules/m_permchannels.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_permchannels.cpp $>
+modules/m_randquote.so: modules/m_randquote.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_randquote.cpp $>
+modules/m_redirect.so: modules/m_redirect.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_redirect.cpp $>
+modules/m_regex_glob.so: modules/m_regex_glob.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/regex.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_regex_glob.cpp $>
+modules/m_regonlycreate.so: modules/m_regonlycreate.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/account.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_regonlycreate.cpp $>
+modules/m_remove.so: modules/m_remove.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_remove.cpp $>
+modules/m_repeat.so: modules/m_repeat.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_repeat.cpp $>
+modules/m_restrictchans.so: modules/m_restrictchans.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_restrictchans.cpp $>
+modules/m_restrictmsg.so: modules/m_restrictmsg.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_restrictmsg.cpp $>
+modules/m_ripemd160.so: modules/m_ripemd160.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/hash.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_ripemd160.cpp $>
+modules/m_rline.so: modules/m_rline.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/regex.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_rline.cpp $>
+modules/m_rmode.so: modules/m_rmode.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_rmode.cpp $>
+modules/m_sajoin.so: modules/m_sajoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_sajoin.cpp $>
+modules/m_sakick.so: modules/m_sakick.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_sakick.cpp $>
+modules/m_samode.so: modules/m_samode.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_samode.cpp $>
+modules/m_sanick.so: modules/m_sanick.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_sanick.cpp $>
+modules/m_sapart.so: modules/m_sapart.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_sapart.cpp $>
+modules/m_saquit.so: modules/m_saquit.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_saquit.cpp $>
+modules/m_sasl.so: modules/m_sasl.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/account.h include/modules/cap.h include/modules/sasl.h include/modules/ssl.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_sasl.cpp $>
+modules/m_satopic.so: modules/m_satopic.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_satopic.cpp $>
+modules/m_securelist.so: modules/m_securelist.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_securelist.cpp $>
+modules/m_seenicks.so: modules/m_seenicks.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_seenicks.cpp $>
+modules/m_serverban.so: modules/m_serverban.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_serverban.cpp $>
+modules/m_services_account.so: modules/m_services_account.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/account.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_services_account.cpp $>
+modules/m_servprotect.so: modules/m_servprotect.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_servprotect.cpp $>
+modules/m_sethost.so: modules/m_sethost.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_sethost.cpp $>
+modules/m_setident.so: modules/m_setident.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_setident.cpp $>
+modules/m_setidle.so: modules/m_setidle.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_setidle.cpp $>
+modules/m_setname.so: modules/m_setname.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_setname.cpp $>
+modules/m_sha256.so: modules/m_sha256.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/hash.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_sha256.cpp $>
+modules/m_showfile.so: modules/m_showfile.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_showfile.cpp $>
+modules/m_showwhois.so: modules/m_showwhois.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_showwhois.cpp $>
+modules/m_shun.so: modules/m_shun.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_shun.cpp $>
+modules/m_silence.so: modules/m_silence.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_silence.cpp $>
+obj/m_spanningtree/addline.o: modules/m_spanningtree/addline.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/addline.cpp $>
+obj/m_spanningtree/away.o: modules/m_spanningtree/away.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/away.cpp $>
+obj/m_spanningtree/capab.o: modules/m_spanningtree/capab.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/capab.cpp $>
+obj/m_spanningtree/compat.o: modules/m_spanningtree/compat.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/compat.cpp $>
+obj/m_spanningtree/delline.o: modules/m_spanningtree/delline.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/delline.cpp $>
+obj/m_spanningtree/encap.o: modules/m_spanningtree/encap.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/encap.cpp $>
+obj/m_spanningtree/fjoin.o: modules/m_spanningtree/fjoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/fjoin.cpp $>
+obj/m_spanningtree/fmode.o: modules/m_spanningtree/fmode.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/fmode.cpp $>
+obj/m_spanningtree/ftopic.o: modules/m_spanningtree/ftopic.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/ftopic.cpp $>
+obj/m_spanningtree/hmac.o: modules/m_spanningtree/hmac.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/modules/hash.h include/modules/ssl.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/hmac.cpp $>
+obj/m_spanningtree/idle.o: modules/m_spanningtree/idle.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/idle.cpp $>
+obj/m_spanningtree/ijoin.o: modules/m_spanningtree/ijoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/ijoin.cpp $>
+obj/m_spanningtree/main.o: modules/m_spanningtree/main.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/resolvers.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/translate.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/main.cpp $>
+obj/m_spanningtree/metadata.o: modules/m_spanningtree/metadata.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/metadata.cpp $>
+obj/m_spanningtree/misccommands.o: modules/m_spanningtree/misccommands.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/misccommands.cpp $>
+obj/m_spanningtree/netburst.o: modules/m_spanningtree/netburst.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/listmode.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/netburst.cpp $>
+obj/m_spanningtree/nick.o: modules/m_spanningtree/nick.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/nick.cpp $>
+obj/m_spanningtree/nickcollide.o: modules/m_spanningtree/nickcollide.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/nickcollide.cpp $>
+obj/m_spanningtree/opertype.o: modules/m_spanningtree/opertype.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/opertype.cpp $>
+obj/m_spanningtree/override_map.o: modules/m_spanningtree/override_map.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/override_map.cpp $>
+obj/m_spanningtree/override_squit.o: modules/m_spanningtree/override_squit.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/override_squit.cpp $>
+obj/m_spanningtree/override_stats.o: modules/m_spanningtree/override_stats.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/override_stats.cpp $>
+obj/m_spanningtree/override_whois.o: modules/m_spanningtree/override_whois.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/override_whois.cpp $>
+obj/m_spanningtree/ping.o: modules/m_spanningtree/ping.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/ping.cpp $>
+obj/m_spanningtree/pong.o: modules/m_spanningtree/pong.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/pong.cpp $>
+obj/m_spanningtree/postcommand.o: modules/m_spanningtree/postcommand.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/postcommand.cpp $>
+obj/m_spanningtree/precommand.o: modules/m_spanningtree/precommand.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/precommand.cpp $>
+obj/m_spanningtree/protocolinterface.o: modules/m_spanningtree/protocolinterface.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/protocolinterface.cpp $>
+obj/m_spanningtree/push.o: modules/m_spanningtree/push.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/push.cpp $>
+obj/m_spanningtree/rconnect.o: modules/m_spanningtree/rconnect.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/rconnect.cpp $>
+obj/m_spanningtree/resolvers.o: modules/m_spanningtree/resolvers.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/resolvers.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/resolvers.cpp $>
+obj/m_spanningtree/rsquit.o: modules/m_spanningtree/rsquit.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/rsquit.cpp $>
+obj/m_spanningtree/save.o: modules/m_spanningtree/save.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/save.cpp $>
+obj/m_spanningtree/server.o: modules/m_spanningtree/server.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/server.cpp $>
+obj/m_spanningtree/servercommand.o: modules/m_spanningtree/servercommand.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/servercommand.cpp $>
+obj/m_spanningtree/sinfo.o: modules/m_spanningtree/sinfo.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/sinfo.cpp $>
+obj/m_spanningtree/svsjoin.o: modules/m_spanningtree/svsjoin.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/svsjoin.cpp $>
+obj/m_spanningtree/svsnick.o: modules/m_spanningtree/svsnick.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/svsnick.cpp $>
+obj/m_spanningtree/svspart.o: modules/m_spanningtree/svspart.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/svspart.cpp $>
+obj/m_spanningtree/translate.o: modules/m_spanningtree/translate.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/translate.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/translate.cpp $>
+obj/m_spanningtree/treeserver.o: modules/m_spanningtree/treeserver.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/modules/spanningtree.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/treeserver.cpp $>
+obj/m_spanningtree/treesocket1.o: modules/m_spanningtree/treesocket1.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/modules/spanningtree.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/treesocket1.cpp $>
+obj/m_spanningtree/treesocket2.o: modules/m_spanningtree/treesocket2.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/resolvers.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/treesocket2.cpp $>
+obj/m_spanningtree/uid.o: modules/m_spanningtree/uid.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/uid.cpp $>
+obj/m_spanningtree/utils.o: modules/m_spanningtree/utils.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/dns.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h modules/m_spanningtree/cachetimer.h modules/m_spanningtree/commandbuilder.h modules/m_spanningtree/commands.h modules/m_spanningtree/link.h modules/m_spanningtree/main.h modules/m_spanningtree/protocolinterface.h modules/m_spanningtree/resolvers.h modules/m_spanningtree/servercommand.h modules/m_spanningtree/treeserver.h modules/m_spanningtree/treesocket.h modules/m_spanningtree/utils.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-o$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_spanningtree/utils.cpp $>
+modules/m_spanningtree.so: obj/m_spanningtree/addline.o obj/m_spanningtree/away.o obj/m_spanningtree/capab.o obj/m_spanningtree/compat.o obj/m_spanningtree/delline.o obj/m_spanningtree/encap.o obj/m_spanningtree/fjoin.o obj/m_spanningtree/fmode.o obj/m_spanningtree/ftopic.o obj/m_spanningtree/hmac.o obj/m_spanningtree/idle.o obj/m_spanningtree/ijoin.o obj/m_spanningtree/main.o obj/m_spanningtree/metadata.o obj/m_spanningtree/misccommands.o obj/m_spanningtree/netburst.o obj/m_spanningtree/nick.o obj/m_spanningtree/nickcollide.o obj/m_spanningtree/opertype.o obj/m_spanningtree/override_map.o obj/m_spanningtree/override_squit.o obj/m_spanningtree/override_stats.o obj/m_spanningtree/override_whois.o obj/m_spanningtree/ping.o obj/m_spanningtree/pong.o obj/m_spanningtree/postcommand.o obj/m_spanningtree/precommand.o obj/m_spanningtree/protocolinterface.o obj/m_spanningtree/push.o obj/m_spanningtree/rconnect.o obj/m_spanningtree/resolvers.o obj/m_spanningtree/rsquit.o obj/m_spanningtree/save.o obj/m_spanningtree/server.o obj/m_spanningtree/servercommand.o obj/m_spanningtree/sinfo.o obj/m_spanningtree/svsjoin.o obj/m_spanningtree/svsnick.o obj/m_spanningtree/svspart.o obj/m_spanningtree/translate.o obj/m_spanningtree/treeserver.o obj/m_spanningtree/treesocket1.o obj/m_spanningtree/treesocket2.o obj/m_spanningtree/uid.o obj/m_spanningtree/utils.o
+	@$(SOURCEPATH)/make/unit-cc.pl link-dir$(VERBOSE) $@ $^ $>
+modules/m_sqlauth.so: modules/m_sqlauth.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/hash.h include/modules/sql.h include/modules/ssl.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_sqlauth.cpp $>
+modules/m_sqloper.so: modules/m_sqloper.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/hash.h include/modules/sql.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_sqloper.cpp $>
+modules/m_sslinfo.so: modules/m_sslinfo.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/ssl.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_sslinfo.cpp $>
+modules/m_sslmodes.so: modules/m_sslmodes.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/ssl.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_sslmodes.cpp $>
+modules/m_starttls.so: modules/m_starttls.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/cap.h include/modules/ssl.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_starttls.cpp $>
+modules/m_stripcolor.so: modules/m_stripcolor.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_stripcolor.cpp $>
+modules/m_svshold.so: modules/m_svshold.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_svshold.cpp $>
+modules/m_swhois.so: modules/m_swhois.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_swhois.cpp $>
+modules/m_testnet.so: modules/m_testnet.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_testnet.cpp $>
+modules/m_timedbans.so: modules/m_timedbans.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_timedbans.cpp $>
+modules/m_tline.so: modules/m_tline.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_tline.cpp $>
+modules/m_topiclock.so: modules/m_topiclock.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_topiclock.cpp $>
+modules/m_uhnames.so: modules/m_uhnames.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/modules/cap.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_uhnames.cpp $>
+modules/m_uninvite.so: modules/m_uninvite.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_uninvite.cpp $>
+modules/m_userip.so: modules/m_userip.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_userip.cpp $>
+modules/m_vhost.so: modules/m_vhost.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_vhost.cpp $>
+modules/m_watch.so: modules/m_watch.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_watch.cpp $>
+modules/m_xline_db.so: modules/m_xline_db.cpp include/aligned_storage.h include/bancache.h include/base.h include/caller.h include/channels.h include/cidr_trie.h include/command_parse.h include/compat.h include/config.h include/configreader.h include/consolecolors.h include/ctables.h include/cull_list.h include/dynamic.h include/dynref.h include/extensible.h include/filelogger.h include/fileutils.h include/flat_map.h include/hashcomp.h include/inspircd.h include/inspsocket.h include/inspstring.h include/intrusive_list.h include/intrusive_list_impl.h include/iohook.h include/iothread.h include/isupportmanager.h include/logger.h include/membership.h include/mode.h include/modechange.h include/modules.h include/numerics.h include/object_pool.h include/parammode.h include/pointer_map.h include/protocol.h include/server.h include/small_vector.h include/snomasks.h include/socket.h include/socketengine.h include/stdalgo.h include/threadengine.h include/threadengines/threadengine_pthread.h include/threadengines/threadengine_win32.h include/timer.h include/typedefs.h include/uid.h include/usermanager.h include/users.h include/wildcard.h include/xline.h
+	@$(SOURCEPATH)/make/unit-cc.pl gen-so$(VERBOSE) $@ $(SOURCEPATH)/src/modules/m_xline_db.cpp $>
+
+bin/inspircd: obj/bancache.o obj/base.o obj/channels.o obj/cidr.o obj/command_parse.o obj/commands.o obj/configparser.o obj/configreader.o obj/cull_list.o obj/dynamic.o obj/filelogger.o obj/fileutils.o obj/hashcomp.o obj/helperfuncs.o obj/inspircd.o obj/inspsocket.o obj/inspstring.o obj/iothread.o obj/listensocket.o obj/listmode.o obj/logger.o obj/mode.o obj/modmanager_dynamic.o obj/modmanager_static.o obj/modules.o obj/server.o obj/snomasks.o obj/socket.o obj/socketengine.o obj/testsuite.o obj/threadengine.o obj/timer.o obj/usermanager.o obj/users.o obj/wildcard.o obj/xline.o obj/cmode_k.o obj/cmode_l.o obj/umode_o.o obj/umode_s.o obj/socketengine_uring.o obj/threadengine_pthread.o
+	@$(SOURCEPATH)/make/unit-cc.pl core-ld$(VERBOSE) $@ $^ $>
+
+inspircd: bin/inspircd
+
+coremods: modules/core_channel.so modules/core_dns.so modules/core_hostname_lookup.so modules/core_info.so modules/core_ison.so modules/core_list.so modules/core_loadmodule.so modules/core_lusers.so modules/core_oper.so modules/core_privmsg.so modules/core_reloadmodule.so modules/core_stats.so modules/core_stub.so modules/core_user.so modules/core_userhost.so modules/core_wallops.so modules/core_who.so modules/core_whois.so modules/core_whowas.so modules/core_xline.so
+
+modules: modules/m_abbreviation.so modules/m_alias.so modules/m_allowinvite.so modules/m_alltime.so modules/m_auditorium.so modules/m_autoop.so modules/m_banexception.so modules/m_banredirect.so modules/m_bcrypt.so modules/m_blockamsg.so modules/m_blockcaps.so modules/m_blockcolor.so modules/m_botmode.so modules/m_callerid.so modules/m_cap.so modules/m_cban.so modules/m_censor.so modules/m_cgiirc.so modules/m_chancreate.so modules/m_chanfilter.so modules/m_chanhistory.so modules/m_chanlog.so modules/m_channames.so modules/m_channelban.so modules/m_check.so modules/m_chghost.so modules/m_chgident.so modules/m_chgname.so modules/m_clearchan.so modules/m_cloaking.so modules/m_clones.so modules/m_close.so modules/m_commonchans.so modules/m_conn_join.so modules/m_conn_umodes.so modules/m_conn_waitpong.so modules/m_connectban.so modules/m_connflood.so modules/m_customprefix.so modules/m_customtitle.so modules/m_cycle.so modules/m_dccallow.so modules/m_deaf.so modules/m_delayjoin.so modules/m_delaymsg.so modules/m_denychans.so modules/m_devoice.so modules/m_dnsbl.so modules/m_exemptchanops.so modules/m_filter.so modules/m_flashpolicyd.so modules/m_gecosban.so modules/m_globalload.so modules/m_globops.so modules/m_helpop.so modules/m_hidechans.so modules/m_hidelist.so modules/m_hideoper.so modules/m_hostchange.so modules/m_hostcycle.so modules/m_httpd.so modules/m_httpd_acl.so modules/m_httpd_config.so modules/m_httpd_stats.so modules/m_ident.so modules/m_inviteexception.so modules/m_ircv3.so modules/m_joinflood.so modules/m_jumpserver.so modules/m_kicknorejoin.so modules/m_knock.so modules/m_ldapauth.so modules/m_ldapoper.so modules/m_lockserv.so modules/m_maphide.so modules/m_md5.so modules/m_messageflood.so modules/m_mlock.so modules/m_modenotice.so modules/m_muteban.so modules/m_namedmodes.so modules/m_namesx.so modules/m_nationalchars.so modules/m_nickflood.so modules/m_nicklock.so modules/m_noctcp.so modules/m_nokicks.so modules/m_nonicks.so modules/m_nonotice.so modules/m_nopartmsg.so modules/m_ojoin.so modules/m_operchans.so modules/m_operjoin.so modules/m_operlevels.so modules/m_operlog.so modules/m_opermodes.so modules/m_opermotd.so modules/m_operprefix.so modules/m_override.so modules/m_passforward.so modules/m_password_hash.so modules/m_pbkdf2.so modules/m_permchannels.so modules/m_randquote.so modules/m_redirect.so modules/m_regex_glob.so modules/m_regonlycreate.so modules/m_remove.so modules/m_repeat.so modules/m_restrictchans.so modules/m_restrictmsg.so modules/m_ripemd160.so modules/m_rline.so modules/m_rmode.so modules/m_sajoin.so modules/m_sakick.so modules/m_samode.so modules/m_sanick.so modules/m_sapart.so modules/m_saquit.so modules/m_sasl.so modules/m_satopic.so modules/m_securelist.so modules/m_seenicks.so modules/m_serverban.so modules/m_services_account.so modules/m_servprotect.so modules/m_sethost.so modules/m_setident.so modules/m_setidle.so modules/m_setname.so modules/m_sha256.so modules/m_showfile.so modules/m_showwhois.so modules/m_shun.so modules/m_silence.so modules/m_spanningtree.so modules/m_sqlauth.so modules/m_sqloper.so modules/m_sslinfo.so modules/m_sslmodes.so modules/m_starttls.so modules/m_stripcolor.so modules/m_svshold.so modules/m_swhois.so modules/m_testnet.so modules/m_timedbans.so modules/m_tline.so modules/m_topiclock.so modules/m_uhnames.so modules/m_uninvite.so modules/m_userip.so modules/m_vhost.so modules/m_watch.so modules/m_xline_db.so
+
+.PHONY: all bad-target inspircd coremods modules
+
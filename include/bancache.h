@@ -27,7 +27,7 @@
  * entries expire every few hours, which is a reasonable expiry for any reasonable
  * sized network.
  */
-class CoreExport BanCacheHit
+class CoreExport BanCacheHit : public insp::intrusive_list_node<BanCacheHit>
 {
  public:
 	/** Type of cached ban
@@ -39,6 +39,13 @@ class CoreExport BanCacheHit
 	/** Time that the ban expires at
 	 */
 	time_t Expiry;
+	/** The address or range of addresses the hit is for
+	 */
+	irc::sockets::cidr_mask Range;
+	/** Generation of the entries of the type of this hit when it was added, the hit
+	 * is ignored if the entries of the type have been removed since then
+	 */
+	unsigned long Generation;
 
 	BanCacheHit(const std::string& type, const std::string& reason, time_t seconds);
 
@@ -49,25 +56,72 @@ class CoreExport BanCacheHit
  */
 class CoreExport BanCacheManager
 {
+	struct RangeHash
+	{
+		size_t operator()(const irc::sockets::cidr_mask& range) const;
+	};
+
 	/** A container of ban cache items.
 	 */
-	typedef TR1NS::unordered_map<std::string, BanCacheHit*, TR1NS::hash<std::string> > BanCacheHash;
+	typedef TR1NS::unordered_map<irc::sockets::cidr_mask, BanCacheHit*, RangeHash> BanCacheHash;
 
 	BanCacheHash BanHash;
+
+	/** The hits, from the most to the least recently used
+	 */
+	insp::intrusive_list_tail<BanCacheHit> LRU;
+
+	/** Generations of the positive hits of each type, and of all negative hits.
+	 * Incrementing a generation removes all hits of it at once.
+	 */
+	std::map<std::string, unsigned long> Generations;
+	unsigned long NegativeGeneration;
+
+	/** Number of hits for a range of addresses, by address family and prefix length.
+	 * These are the prefix lengths which have to be looked up for an address. Lengths
+	 * which have no hits any more are kept, there are at most a few hundred of them.
+	 */
+	std::map<std::pair<unsigned char, unsigned char>, unsigned long> Ranges;
+
+	/** Check whether a hit has expired or has been removed, and delete it if it has
+	 * @param it The hit to check
+	 * @return True if the hit was deleted
+	 */
 	bool RemoveIfExpired(BanCacheHash::iterator& it);
 
+	void RemoveHit(BanCacheHash::iterator& it);
+
+	unsigned long GetGeneration(const BanCacheHit* b) const;
+
  public:
+	BanCacheManager() : NegativeGeneration(0) { }
 
 	/** Creates and adds a Ban Cache item.
-	 * @param ip The IP the item is for.
+	 * @param range The address or range of addresses the item is for. A positive hit for a range of
+	 * addresses must only be added if every address in it is banned by the line.
 	 * @param type The type of ban cache item. std::string. .empty() means it's a negative match (user is allowed freely).
 	 * @param reason The reason for the ban. Left .empty() if it's a negative match.
 	 * @param seconds Number of seconds before nuking the bancache entry, the default is a day. This might seem long, but entries will be removed as glines/etc expire.
+	 * @return The new item, or NULL if there is an item for the range already or the address is not an IP address
+	 */
+	BanCacheHit *AddHit(const irc::sockets::cidr_mask& range, const std::string &type, const std::string &reason, time_t seconds = 0);
+
+	/** Creates and adds a Ban Cache item for a single IP address.
+	 * @param sa The IP address the item is for.
+	 * @param type The type of ban cache item. std::string. .empty() means it's a negative match (user is allowed freely).
+	 * @param reason The reason for the ban. Left .empty() if it's a negative match.
+	 * @param seconds Number of seconds before nuking the bancache entry, the default is a day.
+	 * @return The new item, or NULL if there is an item for the address already or it is not an IP address
+	 */
+	BanCacheHit *AddHit(const irc::sockets::sockaddrs& sa, const std::string &type, const std::string &reason, time_t seconds = 0);
+
+	/** Find the item for an IP address, or for a range of addresses it is in
+	 * @param sa The IP address to look up
+	 * @return The item, or NULL if there is none
 	 */
-	BanCacheHit *AddHit(const std::string &ip, const std::string &type, const std::string &reason, time_t seconds = 0);
-	BanCacheHit *GetHit(const std::string &ip);
+	BanCacheHit *GetHit(const irc::sockets::sockaddrs& sa);
 
-	/** Removes all entries of a given type, either positive or negative. Returns the number of hits removed.
+	/** Removes all entries of a given type, either positive or negative.
 	 * @param type The type of bancache entries to remove (e.g. 'G')
 	 * @param positive Remove either positive (true) or negative (false) hits.
 	 */
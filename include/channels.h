@@ -37,9 +37,14 @@
 class CoreExport Channel : public Extensible, public InviteBase<Channel>
 {
  public:
-	/** A map of Memberships on a channel keyed by User pointers
+	/** A map of Memberships on a channel keyed by User pointers.
+	 * It is iterated in no particular order, and the order may change when a user joins.
 	 */
- 	typedef std::map<User*, insp::aligned_storage<Membership> > MemberMap;
+	typedef insp::pointer_map<User*, Membership*> MemberMap;
+
+	/** A list of the Memberships of the local users on a channel, in no particular order
+	 */
+	typedef std::vector<Membership*> LocalMemberList;
 
  private:
 	/** Set default modes for the channel on creation
@@ -92,6 +97,11 @@ class CoreExport Channel : public Extensible, public InviteBase<Channel>
 	 */
 	MemberMap userlist;
 
+	/** Memberships of the local users in userlist.
+	 * Messages are only written to local users, so sending to a channel only walks this list.
+	 */
+	LocalMemberList localusers;
+
 	/** Channel topic.
 	 * If this is an empty string, no channel topic is set.
 	 */
@@ -107,6 +117,23 @@ class CoreExport Channel : public Extensible, public InviteBase<Channel>
 	 */
 	std::string setby; /* 128 */
 
+	/** Incremented whenever something which can change the result of IsBanned() for a member
+	 * changes on this channel, such as an entry being added to or removed from a list mode.
+	 * Membership::IsBanned() compares this to the value it cached its verdict at.
+	 */
+	unsigned long bangeneration;
+
+	/** True if a module has marked the ban check in progress as not cacheable, see MarkBanCheckVolatile()
+	 */
+	static bool bancheckvolatile;
+
+	/** Mark the ban check in progress as not cacheable. Modules call this from OnCheckBan or
+	 * OnCheckChannelBan when their result depends on something other than the list modes of the
+	 * channel and the nick, ident, host, IP or real name of the user, e.g. the channels the user
+	 * is on or the account the user is logged into.
+	 */
+	static void MarkBanCheckVolatile() { bancheckvolatile = true; }
+
 	/** Sets or unsets a custom mode in the channels info
 	 * @param mode The mode character to set or unset
 	 * @param value True if you want to set the mode or false if you want to remove it
@@ -174,6 +201,14 @@ class CoreExport Channel : public Extensible, public InviteBase<Channel>
 	 */
 	const MemberMap& GetUsers() const { return userlist; }
 
+	/** Get the Memberships of the local users on this channel.
+	 * Use this instead of GetUsers() when only local users are of interest, e.g. when writing a
+	 * message to the members of the channel. Like GetUsers() the list must not be modified, and
+	 * it changes when a local user joins or leaves the channel.
+	 * @return The Memberships of the local users on the channel, in no particular order
+	 */
+	const LocalMemberList& GetLocalUsers() const { return localusers; }
+
 	/** Returns true if the user given is on the given channel.
 	 * @param user The user to look for
 	 * @return True if the user is on this channel
@@ -298,6 +333,16 @@ class CoreExport Channel : public Extensible, public InviteBase<Channel>
 	/** Write a line of text that already includes the source */
 	void RawWriteAllExcept(User* user, bool serversource, char status, CUList &except_list, const std::string& text);
 
+	/** Write a line built with LineBuilder to all local users on a channel except a list of users.
+	 * The line is not copied, all recipients share it.
+	 * @param user Unused, the source is already part of the line
+	 * @param serversource Unused, the source is already part of the line
+	 * @param status The status of the users to write to, e.g. '@' or '%'. Use a value of 0 to write to everyone
+	 * @param except_list A list of users NOT to send the line to
+	 * @param line The line to send
+	 */
+	void RawWriteAllExcept(User* user, bool serversource, char status, CUList &except_list, const reference<SendBuffer>& line);
+
 	/** Return the channel's modes with parameters.
 	 * @param showkey If this is set to true, the actual key is shown,
 	 * otherwise it is replaced with '&lt;KEY&gt;'
@@ -325,15 +370,26 @@ class CoreExport Channel : public Extensible, public InviteBase<Channel>
 	unsigned int GetPrefixValue(User* user);
 
 	/** Check if a user is banned on this channel
+	 * If the user is a member of the channel, Membership::IsBanned() is faster as it may be able
+	 * to return a cached result.
 	 * @param user A user to check against the banlist
 	 * @returns True if the user given is banned
 	 */
 	bool IsBanned(User* user);
 
-	/** Check a single ban for match
+	/** Check a single ban for match. The mask is matched without compiling it, use the
+	 * other overload to check a mask which is checked often, e.g. one in a list mode.
 	 */
 	bool CheckBan(User* user, const std::string& banmask);
 
+	/** Check a single ban for match
+	 * @param user A user to check against the ban
+	 * @param matcher The ban mask, compiled with the national case map
+	 * @param cidr The part of the ban mask after the last '@' parsed with irc::sockets::ParseCIDR()
+	 * @return True if the ban matches the user
+	 */
+	bool CheckBan(User* user, const WildcardMask& matcher, const irc::sockets::cidr_mask& cidr);
+
 	/** Get the status of an "action" type extban
 	 */
 	ModResult GetExtBanStatus(User *u, char type);
@@ -0,0 +1,208 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+namespace insp
+{
+
+/** A path compressed binary trie of IPv4 and IPv6 CIDR masks, each with a list of values.
+ * Finding the values of every mask which contains an address takes at most one step per
+ * bit of the address, no matter how many masks there are.
+ */
+template <typename T>
+class cidr_trie
+{
+	/** A node in the trie, for a prefix of an IPv4 or IPv6 address
+	 */
+	struct Node
+	{
+		/** The prefix, bits after length are zero */
+		unsigned char bits[16];
+
+		/** Length of the prefix in bits */
+		unsigned char length;
+
+		Node* child[2];
+
+		/** Values of the masks which are exactly this prefix */
+		std::vector<T> values;
+
+		Node(const unsigned char* prefix, unsigned int len)
+			: length(len)
+		{
+			memset(bits, 0, sizeof(bits));
+			if (len)
+				memcpy(bits, prefix, (len + 7) / 8);
+			if (len % 8)
+				bits[len / 8] &= (0xFF00 >> (len % 8)) & 0xFF;
+			child[0] = child[1] = NULL;
+		}
+
+		~Node()
+		{
+			delete child[0];
+			delete child[1];
+		}
+	};
+
+	/** Roots of the tries for IPv4 and IPv6 masks */
+	Node root4;
+	Node root6;
+
+	static unsigned int GetBit(const unsigned char* bits, unsigned int pos)
+	{
+		return (bits[pos / 8] >> (7 - pos % 8)) & 1;
+	}
+
+	/** Count the leading bits which two prefixes have in common
+	 * @param a The first prefix
+	 * @param b The second prefix
+	 * @param max The number of bits to compare
+	 * @return The number of bits in common, at most max
+	 */
+	static unsigned int CommonBits(const unsigned char* a, const unsigned char* b, unsigned int max)
+	{
+		unsigned int pos = 0;
+		for (; pos < max; pos += 8)
+		{
+			unsigned char diff = a[pos / 8] ^ b[pos / 8];
+			if (diff)
+			{
+				for (; !(diff & 0x80); diff <<= 1)
+					pos++;
+				break;
+			}
+		}
+		return std::min(pos, max);
+	}
+
+	Node* GetRoot(unsigned char type)
+	{
+		return (type == AF_INET) ? &root4 : &root6;
+	}
+
+	const Node* GetRoot(unsigned char type) const
+	{
+		return (type == AF_INET) ? &root4 : &root6;
+	}
+
+	// Non-copyable
+	cidr_trie(const cidr_trie&);
+	cidr_trie& operator=(const cidr_trie&);
+
+ public:
+	cidr_trie()
+		: root4(NULL, 0)
+		, root6(NULL, 0)
+	{
+	}
+
+	/** Add a value for a mask
+	 * @param cidr The mask, must be an IPv4 or IPv6 mask
+	 * @param value The value to add
+	 */
+	void insert(const irc::sockets::cidr_mask& cidr, const T& value)
+	{
+		Node* node = GetRoot(cidr.type);
+		while (node->length != cidr.length)
+		{
+			Node*& link = node->child[GetBit(cidr.bits, node->length)];
+			if (!link)
+			{
+				link = new Node(cidr.bits, cidr.length);
+				link->values.push_back(value);
+				return;
+			}
+
+			/* If the child is longer than the common prefix, put a node for the common prefix in its place */
+			const unsigned int common = CommonBits(link->bits, cidr.bits, std::min(link->length, cidr.length));
+			if (common < link->length)
+			{
+				Node* split = new Node(cidr.bits, common);
+				split->child[GetBit(link->bits, common)] = link;
+				link = split;
+			}
+			node = link;
+		}
+		node->values.push_back(value);
+	}
+
+	/** Remove one copy of a value of a mask
+	 * @param cidr The mask the value was added for
+	 * @param value The value to remove
+	 */
+	void erase(const irc::sockets::cidr_mask& cidr, const T& value)
+	{
+		Node* root = GetRoot(cidr.type);
+		Node* parent = NULL;
+		Node** parentlink = NULL;
+		Node** link = NULL;
+		Node* node = root;
+		while (node->length != cidr.length)
+		{
+			Node** next = &node->child[GetBit(cidr.bits, node->length)];
+			if (!*next || (*next)->length > cidr.length || CommonBits((*next)->bits, cidr.bits, (*next)->length) < (*next)->length)
+				return;
+
+			parent = node;
+			parentlink = link;
+			link = next;
+			node = *next;
+		}
+
+		stdalgo::erase(node->values, value);
+		if ((node == root) || (!node->values.empty()) || (node->child[0] && node->child[1]))
+			return;
+
+		/* The node is not needed any more, replace it with its only child if it has one */
+		*link = node->child[0] ? node->child[0] : node->child[1];
+		node->child[0] = node->child[1] = NULL;
+		delete node;
+
+		/* If the node was a leaf its parent can now be left with one child and no values */
+		if ((!*link) && (parent != root) && (parent->values.empty()))
+		{
+			*parentlink = parent->child[0] ? parent->child[0] : parent->child[1];
+			parent->child[0] = parent->child[1] = NULL;
+			delete parent;
+		}
+	}
+
+	/** Find the values of every mask which contains an address
+	 * @param sa The address, other families than IPv4 and IPv6 are never found
+	 * @param out The values found are appended to this
+	 */
+	void find(const irc::sockets::sockaddrs& sa, std::vector<T>& out) const
+	{
+		if ((sa.sa.sa_family != AF_INET) && (sa.sa.sa_family != AF_INET6))
+			return;
+
+		const irc::sockets::cidr_mask addr(sa, 128);
+		for (const Node* node = GetRoot(addr.type); node; node = node->child[GetBit(addr.bits, node->length)])
+		{
+			if (CommonBits(node->bits, addr.bits, node->length) < node->length)
+				return;
+
+			out.insert(out.end(), node->values.begin(), node->values.end());
+			if (node->length == addr.length)
+				return;
+		}
+	}
+};
+
+} // namespace insp
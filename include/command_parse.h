@@ -36,13 +36,39 @@ class CoreExport CommandParser
 	/** Process a command from a user.
 	 * @param user The user to parse the command for
 	 * @param cmd The command string to process
+	 * @param command_p Vector to store the parameters in, its strings are overwritten so that their storage is reused
 	 */
-	void ProcessCommand(LocalUser* user, std::string& cmd);
+	void ProcessCommand(LocalUser* user, std::string& cmd, std::vector<std::string>& command_p);
+
+	/** Find a command by its name, ignoring case
+	 * @param name The name of the command, not null terminated
+	 * @param length The length of the name
+	 * @return The command handler, or NULL if there is no command with the given name
+	 */
+	Command* FindCommand(const char* name, size_t length);
 
 	/** Command list, a hash_map of command names to Command*
 	 */
 	CommandMap cmdlist;
 
+	/** The hash table built by BuildCommandTable(). Each bucket holds the seed that maps the
+	 * names hashing to the bucket onto distinct slots, so a lookup hashes the name twice and
+	 * compares it to a single command.
+	 */
+	std::vector<unsigned int> cmdseeds;
+
+	/** The slots of the hash table built by BuildCommandTable(), NULL for unused slots
+	 */
+	std::vector<Command*> cmdslots;
+
+	/** Number of commands added since the hash table was built. These are only in cmdlist.
+	 */
+	size_t unindexedcmds;
+
+	/** Parameter vector kept between calls to ProcessBuffer() so its strings can be reused
+	 */
+	std::vector<std::string> spareparams;
+
  public:
 	/** Default constructor.
 	 */
@@ -71,7 +97,13 @@ class CoreExport CommandParser
 	 * @param commandname The command required. Always use uppercase for this parameter.
 	 * @return a pointer to the command handler, or NULL
 	 */
-	Command* GetHandler(const std::string &commandname);
+	Command* GetHandler(const std::string &commandname) { return FindCommand(commandname.data(), commandname.length()); }
+
+	/** Build a collision free hash table of the currently registered commands which is used to look up
+	 * commands by name. Commands added later are looked up in the command map until the next rebuild.
+	 * This is called after the modules have been loaded on startup and on rehash.
+	 */
+	void BuildCommandTable();
 
 	/** LoopCall is used to call a command handler repeatedly based on the contents of a comma seperated list.
 	 * There are two ways to call this method, either with one potential list or with two potential lists.
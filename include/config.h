@@ -0,0 +1,41 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ *   Copyright (C) 2014 Peter Powell <petpow@saberuk.com>
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#define INSPIRCD_BRANCH   "InspIRCd-2.2"
+#define INSPIRCD_VERSION  "InspIRCd-2.2.0"
+#define INSPIRCD_REVISION "pre"
+#define INSPIRCD_SYSTEM   "Linux 6.18.44-fc-v130"
+
+#define INSPIRCD_CONFIG_PATH "/tmp/insprun/conf"
+#define INSPIRCD_DATA_PATH   "/tmp/insprun/data"
+#define INSPIRCD_LOG_PATH    "/tmp/insprun/logs"
+#define INSPIRCD_MODULE_PATH "/tmp/insprun/modules"
+
+#define INSPIRCD_SOCKETENGINE_NAME "uring"
+
+#ifndef _WIN32
+#define HAS_CLOCK_GETTIME
+#define HAS_EPOLL
+#define HAS_EVENTFD
+#define HAS_ACCEPT4
+#define HAS_SENDMMSG
+#define SOCKETENGINE_OWNS_IO
+#endif
@@ -353,6 +353,22 @@ class CoreExport ServerConfig
 	 */
 	int MaxConn;
 
+	/** The maximum number of connections accepted from a
+	 * listening socket each time it becomes readable.
+	 */
+	unsigned int AcceptBatch;
+
+	/** If set, TCP_CORK is enabled on sockets while writing a sendq
+	 * which needs more than one writev() call, so that only full
+	 * packets are sent.
+	 */
+	bool TCPCork;
+
+	/** The maximum number of addresses and ranges of addresses the ban cache
+	 * holds, the least recently used ones are removed when there are more.
+	 */
+	unsigned long BanCacheSize;
+
 	/** If we should check for clones during CheckClass() in AddUser()
 	 * Setting this to false allows to not trigger on maxclones for users
 	 * that may belong to another class after DNS-lookup is complete.
@@ -366,6 +382,12 @@ class CoreExport ServerConfig
 	 */
 	unsigned int SoftLimit;
 
+	/** The number of threads which perform socket I/O for
+	 * plaintext client connections, or 0 to do all socket
+	 * I/O in the main thread. Only read on startup.
+	 */
+	unsigned int IOThreads;
+
 	/** Maximum number of targets for a multi target command
 	 * such as PRIVMSG or KICK
 	 */
@@ -284,6 +284,38 @@ namespace irc
 		bool GetToken(long &token);
 	};
 
+	/** A token found by irc::tokenize(). It points into the line it was found in instead
+	 * of holding a copy, so it is only valid while that line is not modified or destroyed.
+	 */
+	struct tokenview
+	{
+		/** The first character of the token, not null terminated */
+		const char* data;
+
+		/** Number of characters in the token */
+		size_t length;
+
+		tokenview() : data(""), length(0) { }
+		tokenview(const char* Data, size_t Length) : data(Data), length(Length) { }
+
+		bool empty() const { return (length == 0); }
+
+		/** Copy the token into a string
+		 * @return The characters of the token
+		 */
+		std::string str() const { return std::string(data, length); }
+	};
+
+	/** The tokens of a line. A line with no more than 16 tokens is stored without allocating.
+	 */
+	typedef insp::small_vector<tokenview, 16> tokenlist;
+
+	/** Split a line into tokens exactly as irc::tokenstream does, but without copying them.
+	 * @param line The line to split. The tokens point into it, so it must outlive them.
+	 * @param tokens The list to append the tokens to
+	 */
+	CoreExport void tokenize(const std::string& line, tokenlist& tokens);
+
 	/** The portparser class seperates out a port range into integers.
 	 * A port range may be specified in the input string in the form
 	 * "6660,6661,6662-6669,7020". The end of the stream is indicated by
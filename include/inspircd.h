@@ -45,8 +45,11 @@
 
 #include "intrusive_list.h"
 #include "flat_map.h"
+#include "small_vector.h"
 #include "compat.h"
 #include "aligned_storage.h"
+#include "pointer_map.h"
+#include "object_pool.h"
 #include "typedefs.h"
 #include "stdalgo.h"
 
@@ -77,9 +80,11 @@ struct fakederef
 #include "channels.h"
 #include "timer.h"
 #include "hashcomp.h"
+#include "wildcard.h"
 #include "logger.h"
 #include "usermanager.h"
 #include "socket.h"
+#include "cidr_trie.h"
 #include "ctables.h"
 #include "command_parse.h"
 #include "mode.h"
@@ -88,6 +93,7 @@ struct fakederef
 #include "filelogger.h"
 #include "modules.h"
 #include "threadengine.h"
+#include "iothread.h"
 #include "configreader.h"
 #include "inspstring.h"
 #include "protocol.h"
@@ -217,6 +223,9 @@ class serverstats
 	/** Total bytes of data received
 	 */
 	unsigned long Recv;
+	/** Number of times a socket was corked to write out a large sendq
+	 */
+	unsigned long Corked;
 #ifdef _WIN32
 	/** Cpu usage at last sample
 	*/
@@ -239,7 +248,7 @@ class serverstats
 	 */
 	serverstats()
 		: Accept(0), Refused(0), Unknown(0), Collisions(0), Dns(0),
-		DnsGood(0), DnsBad(0), Connects(0), Sent(0), Recv(0)
+		DnsGood(0), DnsBad(0), Connects(0), Sent(0), Recv(0), Corked(0)
 	{
 	}
 };
@@ -342,6 +351,10 @@ class CoreExport InspIRCd
 	 */
 	ConfigReaderThread* ConfigThread;
 
+	/** Moves the socket I/O of client connections to other threads if enabled
+	 */
+	IOThreadManager IOThreads;
+
 	/** LogManager handles logging.
 	 */
 	LogManager Logs;
@@ -604,6 +617,10 @@ class CoreExport InspIRCd
 	 */
 	InspIRCd(int argc, char** argv);
 
+	/** Destroy the server object, resets ServerInstance to NULL first
+	 */
+	~InspIRCd();
+
 	/** Send a line of WHOIS data to a user.
 	 * @param user user to send the line to
 	 * @param dest user being WHOISed
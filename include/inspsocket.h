@@ -26,6 +26,7 @@
 #include "timer.h"
 
 class IOHook;
+struct IOThreadConnection;
 
 /**
  * States which a socket may be in
@@ -97,6 +98,139 @@ class CoreExport SocketTimeout : public Timer
 	virtual bool Tick(time_t now);
 };
 
+/** A block of data waiting to be sent. Once created the data is never modified, which
+ * allows the same block to be queued on any number of sockets at the same time, e.g.
+ * when a line is sent to every local member of a channel. The block is freed when the
+ * last socket which has queued it has finished sending it.
+ * The objects are allocated from a pool and the storage of the data of freed blocks is
+ * reused by LineBuilder, so sending a line usually does not touch the heap.
+ */
+class CoreExport SendBuffer
+{
+	mutable unsigned int refcount;
+
+	/** The data to send */
+	std::string data;
+
+	// uncopyable
+	SendBuffer(const SendBuffer&);
+	void operator=(const SendBuffer&);
+
+	/** Create an empty send buffer which is filled by a LineBuilder.
+	 * The storage of the data of a freed buffer is reused if there is one.
+	 */
+	SendBuffer();
+
+ public:
+	/** Create a new send buffer
+	 * @param text The data to send
+	 */
+	SendBuffer(const std::string& text) : refcount(0), data(text) { }
+
+	/** Create a new send buffer containing a line of text
+	 * @param text The line to send, without the line terminator
+	 * @param terminator The line terminator to append to the text
+	 */
+	SendBuffer(const std::string& text, const char* terminator) : refcount(0)
+	{
+		data.reserve(text.length() + 2);
+		data.append(text).append(terminator);
+	}
+
+	/** Destructor, keeps the storage of the data for reuse if it is the size of a line
+	 */
+	~SendBuffer();
+
+	/** Allocate a send buffer from the pool, objects of derived classes which are larger come from the heap */
+	static void* operator new(size_t size);
+	static void operator delete(void* ptr, size_t size);
+
+	/** Get the data in this buffer */
+	inline const std::string& GetData() const { return data; }
+
+	/** Returns true if more than one socket has this buffer queued */
+	inline bool IsShared() const { return refcount > 1; }
+
+	inline void refcount_inc() const { refcount++; }
+	inline bool refcount_dec() const { refcount--; return !refcount; }
+
+	friend class StreamSocket;
+	friend class LineBuilder;
+};
+
+/** The receive queue of a StreamSocket. The data is kept in one contiguous buffer which
+ * the socket reads into directly. Consuming data from the front only moves an offset; the
+ * consumed space is reclaimed when more room is needed, so splitting pipelined input into
+ * lines costs time linear in the amount of input instead of shifting the whole queue once
+ * per line.
+ */
+class CoreExport RecvQueue
+{
+	/** The storage, or NULL if none is allocated */
+	char* buffer;
+	/** Size of the storage */
+	size_t capacity;
+	/** Offset of the first unconsumed byte */
+	size_t start;
+	/** Offset one past the last received byte */
+	size_t end;
+
+	// uncopyable
+	RecvQueue(const RecvQueue&);
+	void operator=(const RecvQueue&);
+
+ public:
+	static const size_t npos = std::string::npos;
+
+	RecvQueue() : buffer(NULL), capacity(0), start(0), end(0) { }
+	~RecvQueue() { delete[] buffer; }
+
+	/** Get a pointer to the unconsumed data. The pointer is invalidated by any non-const method. */
+	inline const char* data() const { return buffer + start; }
+
+	/** Get the number of bytes in the queue */
+	inline size_t length() const { return end - start; }
+
+	/** Returns true if the queue is empty */
+	inline bool empty() const { return start == end; }
+
+	inline char operator[](size_t pos) const { return buffer[start + pos]; }
+
+	/** Find a character in the queue
+	 * @param c The character to find
+	 * @param pos Position to start searching at
+	 * @return Position of the character relative to the front of the queue, or npos if not found
+	 */
+	size_t find(char c, size_t pos = 0) const;
+
+	/** Copy part of the queue into a string */
+	std::string substr(size_t pos = 0, size_t n = npos) const;
+
+	/** Get the contents of the queue as a string */
+	inline std::string str() const { return std::string(data(), length()); }
+
+	/** Append data to the back of the queue */
+	void append(const char* data, size_t len);
+
+	/** Get a buffer to receive at most size bytes into. Call Commit() afterwards with the number
+	 * of bytes which were actually written to the buffer.
+	 * @param size The size of the buffer
+	 * @return A pointer to at least size bytes of free space at the back of the queue
+	 */
+	char* GetWriteBuffer(size_t size);
+
+	/** Add bytes written to the buffer returned by GetWriteBuffer() to the queue */
+	inline void Commit(size_t len) { end += len; }
+
+	/** Remove data from the front of the queue, this does not move any data
+	 * @param len Number of bytes to remove
+	 */
+	void Consume(size_t len);
+
+	/** Remove all data from the queue and free its storage */
+	void clear();
+};
+
 /**
  * StreamSocket is a class that wraps a TCP socket and handles send
  * and receive queues, including passing them to IO hooks
@@ -106,17 +240,33 @@ class CoreExport StreamSocket : public EventHandler
 	/** The IOHook that handles raw I/O for this socket, or NULL */
 	IOHook* iohook;
 
-	/** Private send queue. Note that individual strings may be shared
+	/** The connection of the I/O thread which does the raw I/O of this socket, or NULL */
+	IOThreadConnection* threadconn;
+
+	/** Private send queue. Note that individual buffers may be shared with other sockets
 	 */
-	std::deque<std::string> sendq;
+	std::deque<reference<SendBuffer> > sendq;
+	/** Number of bytes at the start of the first buffer in the sendq which have already been sent */
+	size_t sendq_offset;
 	/** Length, in bytes, of the sendq */
 	size_t sendq_len;
+	/** True if TCP_CORK is set on the socket while a large sendq is written out */
+	bool corked;
+
+	/** Make the first buffer in the sendq private to this socket, dropping the data which
+	 * was already sent. Used before handing the buffer to an IOHook, which may modify it.
+	 */
+	std::string& UnshareSendQFront();
+	/** Copy runs of small buffers at the start of the sendq into larger ones, so that the
+	 * next writev() call is not limited by the number of buffers it can be given.
+	 */
+	void CoalesceSendQ();
 	/** Error - if nonempty, the socket is dead, and this is the reason. */
 	std::string error;
  protected:
-	std::string recvq;
+	RecvQueue recvq;
  public:
-	StreamSocket() : iohook(NULL), sendq_len(0) {}
+	StreamSocket() : iohook(NULL), threadconn(NULL), sendq_offset(0), sendq_len(0), corked(false) {}
 	IOHook* GetIOHook() const;
 	void AddIOHook(IOHook* hook);
 	void DelIOHook();
@@ -143,6 +293,10 @@ class CoreExport StreamSocket : public EventHandler
 	/** Send the given data out the socket, either now or when writes unblock
 	 */
 	void WriteData(const std::string& data);
+	/** Send the given buffer out the socket, either now or when writes unblock.
+	 * The buffer may be queued on other sockets at the same time.
+	 */
+	void WriteData(const reference<SendBuffer>& buffer);
 	/** Convenience function: read a line from the socket
 	 * @param line The line read
 	 * @param delim The line delimiter
@@ -152,12 +306,23 @@ class CoreExport StreamSocket : public EventHandler
 	/** Useful for implementing sendq exceeded */
 	inline size_t getSendQSize() const { return sendq_len; }
 
+	/** Free the receive buffer if it holds no data. The buffer is kept between reads so that
+	 * busy sockets don't reallocate it all the time; call this when the socket has been idle.
+	 */
+	void ReleaseRecvBuffer()
+	{
+		if (recvq.empty())
+			recvq.clear();
+	}
+
 	/**
 	 * Close the socket, remove from socket engine, etc
 	 */
 	virtual void Close();
 	/** This ensures that close is called prior to destructor */
 	virtual CullResult cull();
+
+	friend class IOThreadManager;
 };
 /**
  * BufferedSocket is an extendable socket class which modules
@@ -20,6 +20,7 @@
 #pragma once
 
 class StreamSocket;
+class RecvQueue;
 
 class IOHookProvider : public ServiceProvider
 {
@@ -51,6 +52,39 @@ class IOHookProvider : public ServiceProvider
 	virtual void OnConnect(StreamSocket* sock) = 0;
 };
 
+/** Does the raw I/O of an IOHook on a connection which has been moved to an I/O thread.
+ * All methods are called from the I/O thread, so they must not use any other server state.
+ * The object is created and deleted by the main thread.
+ */
+class IOHookTransport
+{
+ public:
+	virtual ~IOHookTransport() { }
+
+	/** Read and decode data from the socket
+	 * @param buffer Buffer to store the decoded data in
+	 * @param size Size of the buffer
+	 * @param wantwrite Set to true if nothing can be read until the socket is writable
+	 * @return Number of bytes decoded, 0 if the connection was closed, or -1 with errno
+	 *  set on error; errno is EAGAIN if no data is ready
+	 */
+	virtual ssize_t Read(char* buffer, size_t size, bool& wantwrite) = 0;
+
+	/** Encode and write data to the socket. If this returns -1 with errno set to EAGAIN,
+	 * the next call must be made with the same data.
+	 * @param buffer Data to write
+	 * @param size Length of the data
+	 * @param wantread Set to true if nothing can be written until the socket is readable
+	 * @return Number of bytes of the data consumed, or -1 with errno set on error;
+	 *  errno is EAGAIN if nothing can be written yet
+	 */
+	virtual ssize_t Write(const char* buffer, size_t size, bool& wantread) = 0;
+
+	/** Called before the I/O thread closes the file descriptor, e.g. to tell the other side
+	 */
+	virtual void Close() { }
+};
+
 class IOHook : public classbase
 {
  public:
@@ -81,9 +115,18 @@ class IOHook : public classbase
 	/**
 	 * Called when the stream socket has data to read
 	 * @param sock The socket that is ready
-	 * @param recvq The receive queue that new data should be appended to
+	 * @param recvq The receive queue that new data should be appended to. Decoded data can
+	 *  be written directly into the buffer returned by RecvQueue::GetWriteBuffer().
 	 * @return 1 if new data has been read, 0 if no new data is ready (but the
 	 *  socket is still connected), -1 if there was an error or close
 	 */
-	virtual int OnStreamSocketRead(StreamSocket* sock, std::string& recvq) = 0;
+	virtual int OnStreamSocketRead(StreamSocket* sock, RecvQueue& recvq) = 0;
+
+	/** Hand the session of this hook over to an I/O thread. The hook stays attached to the
+	 * socket afterwards, so e.g. the certificate of an SSL connection can still be looked up,
+	 * but the socket does no more I/O through it. OnStreamSocketClose() is still called.
+	 * @param sock The socket in question
+	 * @return An object doing the raw I/O of the session, or NULL if it can't be moved now
+	 */
+	virtual IOHookTransport* DetachTransport(StreamSocket* sock) { return NULL; }
 };
@@ -0,0 +1,153 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "iohook.h"
+
+/** An unbounded, lock-free queue with exactly one producer thread and one consumer thread.
+ * Items are moved in and out of the queue with swap(), so T must have a swap() member
+ * and be default constructible.
+ */
+template <typename T>
+class SPSCQueue
+{
+	struct Node
+	{
+		Node* next;
+		T value;
+		Node() : next(NULL) { }
+	};
+
+	/** The node before the first item, only accessed by the consumer */
+	Node* head;
+
+	/** The last node in the queue, only accessed by the producer */
+	Node* tail;
+
+ public:
+	SPSCQueue()
+		: head(new Node)
+	{
+		tail = head;
+	}
+
+	~SPSCQueue()
+	{
+		while (head)
+		{
+			Node* next = head->next;
+			delete head;
+			head = next;
+		}
+	}
+
+	/** Add an item to the end of the queue. Only call this from the producer thread.
+	 * @param item The item to add, it is left in a default constructed state
+	 */
+	void Push(T& item)
+	{
+		Node* node = new Node;
+		node->value.swap(item);
+		__atomic_store_n(&tail->next, node, __ATOMIC_RELEASE);
+		tail = node;
+	}
+
+	/** Remove the first item from the queue. Only call this from the consumer thread.
+	 * @param item Filled with the item if the queue was not empty
+	 * @return True if an item was removed, false if the queue was empty
+	 */
+	bool Pop(T& item)
+	{
+		Node* next = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE);
+		if (!next)
+			return false;
+		item.swap(next->value);
+		delete head;
+		head = next;
+		return true;
+	}
+};
+
+class IOThread;
+
+/** Moves the socket I/O of registered client connections to a pool of threads.
+ * The main thread still owns all client state and runs every command; the I/O threads
+ * only read lines from and write buffers to the sockets they have been given. Each thread
+ * waits for events with its own epoll instance, and the sockets it owns are detached from
+ * the main socket engine. The buffers of the sendq are handed to the I/O thread as they are,
+ * so a line sent to many sockets is still not copied. Sockets with an IOHook (SSL) are only
+ * moved if the hook can hand its session over with IOHook::DetachTransport(), the I/O thread
+ * then does the encryption as well.
+ */
+class CoreExport IOThreadManager
+{
+	/** The running I/O threads, empty if I/O threads are disabled */
+	std::vector<IOThread*> threads;
+
+ public:
+	/** Start the I/O threads
+	 * @param count Number of threads to start
+	 */
+	void Start(unsigned int count);
+
+	/** Stop and join all I/O threads. Sockets must have been closed before calling this.
+	 */
+	void Stop();
+
+	/** Check whether sockets can be moved to I/O threads
+	 * @return True if there is at least one I/O thread running
+	 */
+	bool IsEnabled() const { return !threads.empty(); }
+
+	/** Wake up the I/O threads which have new requests. Requests are batched so that
+	 * one wakeup is done for each thread per mainloop iteration; this must be called
+	 * after the sendqs have been written.
+	 */
+	void Flush();
+
+	/** Wait until the I/O threads have handled all requests made so far, and free the
+	 * connections they have closed. This must be done before unloading a module, as the
+	 * I/O threads run its IOHookTransport code until they have closed the sockets which
+	 * were closed when the module was unloaded.
+	 */
+	void Sync();
+
+	/** Move a socket to the least loaded I/O thread
+	 * @param sock The socket to move
+	 * @return True if the socket was moved, false if it stays in the main thread
+	 */
+	bool Attach(StreamSocket* sock);
+
+	/** Move the data received by the I/O thread of a socket into its recvq
+	 * @param sock The socket, it must have been moved to an I/O thread
+	 * @return True if there was any data
+	 */
+	bool Read(StreamSocket* sock);
+
+	/** Pass the sendq of a socket to its I/O thread, as much of it as the
+	 * I/O thread accepts; the rest stays in the sendq until it catches up
+	 * @param sock The socket, it must have been moved to an I/O thread
+	 */
+	void Write(StreamSocket* sock);
+
+	/** Close a socket which has been moved to an I/O thread. The I/O thread writes what it
+	 * can of the data it still has and then closes the file descriptor.
+	 * @param sock The socket to close
+	 */
+	void Detach(StreamSocket* sock);
+};
@@ -31,8 +31,17 @@ class CoreExport ListModeBase : public ModeHandler
 		std::string setter;
 		std::string mask;
 		time_t time;
+		/** The mask compiled with the national case map, for matching it as a glob pattern */
+		WildcardMask matcher;
+		/** The part of the mask after the last '@' parsed as a CIDR mask, matches no address if it is not one */
+		irc::sockets::cidr_mask cidr;
 		ListItem(const std::string& Mask, const std::string& Setter, time_t Time)
-			: setter(Setter), mask(Mask), time(Time) { }
+			: setter(Setter), mask(Mask), time(Time), matcher(Mask)
+		{
+			std::string::size_type at = Mask.rfind('@');
+			if (at != std::string::npos)
+				irc::sockets::ParseCIDR(Mask.substr(at + 1), cidr);
+		}
 	};
 
 	/** Items stored in the channel's list
@@ -40,10 +49,68 @@ class CoreExport ListModeBase : public ModeHandler
 	typedef std::vector<ListItem> ModeList;
 
  private:
+	/** Finds the items of a list which may match a user without matching every item, for lists
+	 * of nick!ident\@host masks and extbans. Masks with no wildcards in the host are hashed by the
+	 * host, and those with a CIDR host are also stored in a cidr_trie. Extbans are grouped by their
+	 * type character and all other items are always returned. Items are referred to by their
+	 * position in the list, so the index must be updated whenever the list changes.
+	 */
+	class MaskIndex
+	{
+		typedef TR1NS::unordered_multimap<std::string, size_t> HostMap;
+
+		/** Items with a host without wildcards, by the lowercase host */
+		HostMap hosts;
+
+		/** Items with a CIDR host */
+		insp::cidr_trie<size_t> addresses;
+
+		/** Extbans, by their type character */
+		insp::flat_map<char, std::vector<size_t> > extbans;
+
+		/** Items which cannot be indexed */
+		std::vector<size_t> others;
+
+		/** Find the items with the given host
+		 * @param host The host to look up
+		 * @param list The list the index is for
+		 * @param out The items found are appended to this
+		 */
+		void FindHost(const std::string& host, const ModeList& list, std::vector<const ListItem*>& out) const;
+
+	 public:
+		/** Add an item to the index
+		 * @param item The item
+		 * @param pos The position of the item in the list
+		 */
+		void Add(const ListItem& item, size_t pos);
+
+		/** Remove an item from the index
+		 * @param item The item
+		 * @param pos The position of the item in the list
+		 */
+		void Remove(const ListItem& item, size_t pos);
+
+		/** Find the items which may match a user
+		 * @param user The user to find items for
+		 * @param list The list the index is for
+		 * @param out The items found are appended to this. The extbans of all types are included and an item may be found more than once.
+		 */
+		void Find(User* user, const ModeList& list, std::vector<const ListItem*>& out) const;
+
+		/** Find the extbans of one type
+		 * @param type The extban type character
+		 * @param list The list the index is for
+		 * @param out The items found are appended to this
+		 */
+		void FindExtBans(char type, const ModeList& list, std::vector<const ListItem*>& out) const;
+	};
+
 	class ChanData
 	{
 	public:
 		ModeList list;
+		MaskIndex index;
 		int maxitems;
 
 		ChanData() : maxitems(-1) { }
@@ -129,6 +196,22 @@ class CoreExport ListModeBase : public ModeHandler
 	 */
 	ModeList* GetList(Channel* channel);
 
+	/** Find the items of the list on a channel which may match a user, without matching every item.
+	 * The items are nick!ident\@host masks or extbans, as checked by Channel::CheckBan().
+	 * Changes to the list must be made through OnModeChange() for this to find them.
+	 * @param channel The channel to look in
+	 * @param user The user to find items for
+	 * @param out The items found are appended to this. The extbans of all types are included and an item may be found more than once.
+	 */
+	void FindItems(Channel* channel, User* user, std::vector<const ListItem*>& out);
+
+	/** Find the extbans of one type in the list on a channel
+	 * @param channel The channel to look in
+	 * @param type The extban type character
+	 * @param out The items found are appended to this
+	 */
+	void FindExtBans(Channel* channel, char type, std::vector<const ListItem*>& out);
+
 	/** Display the list for this mode
 	 * See mode.h
 	 * @param user The user to send the list to
@@ -54,6 +54,24 @@ class CoreExport Membership : public Extensible, public insp::intrusive_list_nod
 	 */
 	Id id;
 
+	/** The result of the last ban check of this member, valid while bangeneration and identitygeneration
+	 * equal Channel::bangeneration and User::identitygeneration
+	 */
+	bool banned;
+
+	/** Value of Channel::bangeneration when the cached ban check result was computed, 0 if there is none
+	 */
+	unsigned long bangeneration;
+
+	/** Value of User::identitygeneration when the cached ban check result was computed
+	 */
+	unsigned long identitygeneration;
+
+	/** Position of this Membership in Channel::GetLocalUsers() if the user is local, only the
+	 * Channel should read or write this field.
+	 */
+	size_t localpos;
+
 	/** Converts a string to a Membership::Id
 	 * @param str The string to convert
 	 * @return Raw value of type Membership::Id
@@ -68,7 +86,16 @@ class CoreExport Membership : public Extensible, public insp::intrusive_list_nod
 	 * Call Channel::JoinUser() or ForceJoin() to make a user join a channel instead of constructing
 	 * Membership objects directly.
 	 */
-	Membership(User* u, Channel* c) : user(u), chan(c) {}
+	Membership(User* u, Channel* c) : user(u), chan(c), banned(false), bangeneration(0), identitygeneration(0), localpos(0) {}
+
+	/** Check if this member is banned on the channel.
+	 * The result is the same as Channel::IsBanned() but it is cached until either the list modes
+	 * of the channel or the identity of the user change, as long as every module handling ban
+	 * checks has declared its results cacheable (see Module::cacheablebanchecks) and none marked
+	 * the check volatile (see Channel::MarkBanCheckVolatile()).
+	 * @return True if the member is banned
+	 */
+	bool IsBanned();
 
 	/** Returns true if this member has a given prefix mode set
 	 * @param m The prefix mode letter to check
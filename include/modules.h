@@ -266,6 +266,7 @@ enum Implementation
 	I_OnWhoisLine, I_OnBuildNeighborList, I_OnGarbageCollect, I_OnSetConnectClass,
 	I_OnText, I_OnPassCompare, I_OnNamesListItem, I_OnNumeric,
 	I_OnPreRehash, I_OnModuleRehash, I_OnSendWhoLine, I_OnChangeIdent, I_OnSetUserIP,
+	I_OnBuildBanHostList,
 	I_END
 };
 
@@ -294,6 +295,14 @@ class CoreExport Module : public classbase, public usecountbase
 	 */
 	bool dying;
 
+	/** True if the results this module returns from OnCheckBan and OnCheckChannelBan, and the hosts it
+	 * adds in OnBuildBanHostList, only depend on the list modes of the channel and on the nick, ident,
+	 * host, IP and real name of the user. Membership::IsBanned() only caches its result while every
+	 * module handling those events has set this. Modules set it in their constructor; a module can
+	 * still mark a single check as not cacheable with Channel::MarkBanCheckVolatile().
+	 */
+	bool cacheablebanchecks;
+
 	/** Default constructor.
 	 * Creates a module class. Don't do any type of hook registration or checks
 	 * for other modules here; do that in init().
@@ -556,7 +565,7 @@ class CoreExport Module : public classbase, public usecountbase
 	 *
 	 * Set exceptions[user] = true to include, exceptions[user] = false to exclude
 	 */
-	virtual void OnBuildNeighborList(User* source, IncludeChanList& include_c, std::map<User*, bool>& exceptions);
+	virtual void OnBuildNeighborList(User* source, IncludeChanList& include_c, NeighborExceptions& exceptions);
 
 	/** Called before local nickname changes. This can be used to implement Q-lines etc.
 	 * If your method returns nonzero, the nickchange is silently forbidden, and it is down to your
@@ -821,6 +830,8 @@ class CoreExport Module : public classbase, public usecountbase
 	 * Note that the registration timeout for a user overrides these checks, if the registration
 	 * timeout is reached, the user is disconnected even if modules report that the user is
 	 * not ready to connect.
+	 * This is not called periodically, a module which holds a user back must call
+	 * LocalUser::CheckReady() for them when it might no longer do so.
 	 * @param user The user to check
 	 * @return true to indicate readiness, false if otherwise
 	 */
@@ -901,6 +912,14 @@ class CoreExport Module : public classbase, public usecountbase
 	 */
 	virtual ModResult OnCheckBan(User* user, Channel* chan, const std::string& mask);
 
+	/** Called when finding the bans which may match a user, to add hosts which the user can be
+	 * banned by other than their real host, displayed host and IP address. Bans with a host
+	 * without wildcards are only checked, and passed to OnCheckBan, if the host is one of these.
+	 * @param user The user whose bans are being found
+	 * @param hosts The extra hosts, modules add to this
+	 */
+	virtual void OnBuildBanHostList(User* user, std::vector<std::string>& hosts);
+
 	/** Checks for a match on a given extban type
 	 * @return MOD_RES_DENY to mark as banned, MOD_RES_ALLOW to skip the
 	 * ban check, or MOD_RES_PASSTHRU to check bans normally
@@ -1104,6 +1123,16 @@ class CoreExport ModuleManager : public fakederef<ModuleManager>
 	 */
 	bool PrioritizeHooks();
 
+	/** Check if an event is one of the events used by Channel::IsBanned()
+	 * @param i The event to check
+	 * @return True if attaching or detaching a module to the event can change ban check results
+	 */
+	static bool IsBanCheckEvent(Implementation i);
+
+	/** Invalidate the ban check results cached by Membership::IsBanned() on every channel
+	 */
+	void InvalidateBanChecks();
+
  public:
 	typedef std::map<std::string, Module*> ModuleMap;
 
@@ -1157,6 +1186,12 @@ class CoreExport ModuleManager : public fakederef<ModuleManager>
 		return SetPriority(mod, i, s, *dptr);
 	}
 
+	/** Check if ban check results may be cached
+	 * @return True if every module attached to OnCheckBan, OnCheckChannelBan and OnBuildBanHostList
+	 * has set Module::cacheablebanchecks
+	 */
+	bool AreBanChecksCacheable() const;
+
 	/** Change the priority of all events in a module.
 	 * @param mod The module to set the priority of
 	 * @param s The priority of all events in the module.
@@ -31,6 +31,8 @@ namespace DNS
 		QUERY_A = 1,
 		/* A CNAME lookup */
 		QUERY_CNAME = 5,
+		/* Start of authority, only used for caching negative answers */
+		QUERY_SOA = 6,
 		/* Reverse DNS lookup */
 		QUERY_PTR = 12,
 		/* IPv6 AAAA lookup */
@@ -135,6 +137,11 @@ namespace DNS
 		virtual void Process(Request* req) = 0;
 		virtual void RemoveRequest(Request* req) = 0;
 		virtual std::string GetErrorStr(Error) = 0;
+
+		/** Called when a request has not been answered in time, before it is removed
+		 * @param req The request which timed out
+		 */
+		virtual void OnTimeout(Request* req) = 0;
 	};
 
 	/** A DNS query.
@@ -182,6 +189,7 @@ namespace DNS
 		 */
 		bool Tick(time_t now)
 		{
+			manager->OnTimeout(this);
 			Query rr(*this);
 			rr.error = ERROR_TIMEDOUT;
 			this->OnError(&rr);
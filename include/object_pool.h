@@ -0,0 +1,95 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <vector>
+
+namespace insp
+{
+
+/** Allocates storage for objects of one type from large blocks.
+ * Freed storage is kept on a free list and handed out again by the next allocation, so
+ * objects which are created and destroyed often neither go through the heap every time
+ * nor end up scattered across it. The blocks are only released when the pool is destroyed.
+ * The pool only provides storage; construct objects in it with placement new and call
+ * their destructor before deallocating them.
+ */
+template <typename T>
+class object_pool
+{
+	/** Storage for one object, linked into the free list while it is not allocated */
+	union Slot
+	{
+		Slot* next;
+		typename TR1NS::aligned_storage<sizeof(T), TR1NS::alignment_of<T>::value>::type data;
+	};
+
+	/** Number of objects per block */
+	static const size_t BlockSize = 256;
+
+	/** All blocks allocated so far */
+	std::vector<Slot*> blocks;
+
+	/** The first unallocated slot, or NULL if all slots are allocated */
+	Slot* freelist;
+
+	// Non-copyable
+	object_pool(const object_pool&);
+	object_pool& operator=(const object_pool&);
+
+ public:
+	object_pool() : freelist(NULL) { }
+
+	~object_pool()
+	{
+		for (typename std::vector<Slot*>::const_iterator i = blocks.begin(); i != blocks.end(); ++i)
+			delete[] *i;
+	}
+
+	/** Allocate storage for an object
+	 * @return Uninitialized storage for one T
+	 */
+	void* allocate()
+	{
+		if (!freelist)
+		{
+			Slot* block = new Slot[BlockSize];
+			blocks.push_back(block);
+			for (size_t i = 0; i < BlockSize - 1; i++)
+				block[i].next = &block[i + 1];
+			block[BlockSize - 1].next = NULL;
+			freelist = block;
+		}
+
+		Slot* slot = freelist;
+		freelist = slot->next;
+		return slot;
+	}
+
+	/** Return storage to the pool
+	 * @param ptr Storage previously returned by allocate() of this pool, the object in it must have been destroyed
+	 */
+	void deallocate(void* ptr)
+	{
+		Slot* slot = static_cast<Slot*>(ptr);
+		slot->next = freelist;
+		freelist = slot;
+	}
+};
+
+} // namespace insp
@@ -0,0 +1,272 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <utility>
+
+namespace insp
+{
+
+/** A hash map keyed by pointers which stores its elements in a single open addressed array.
+ * Looking up a key usually touches one cache line, instead of walking the heap nodes of a tree.
+ *
+ * The interface is a subset of std::map. Unlike std::map the elements are iterated in no
+ * particular order, but the order only changes when an insert grows or cleans up the table.
+ * Erasing an element never moves other elements, so erasing during iteration is safe as long
+ * as the iterator is advanced before the element it points to is erased.
+ * Inserting an element invalidates all iterators.
+ * @tparam K The key type, must be a pointer type. The null pointer and the address 1 are
+ * reserved and cannot be used as keys.
+ * @tparam V The mapped type, should be cheap to copy
+ */
+template <typename K, typename V>
+class pointer_map
+{
+ public:
+	typedef K key_type;
+	typedef V mapped_type;
+	typedef std::pair<K, V> value_type;
+	typedef size_t size_type;
+
+ private:
+	/** The array of slots, a slot with a null key is empty and a slot with the key 1 held an erased element */
+	value_type* slots;
+
+	/** Number of slots, always zero or a power of two */
+	size_type capacity;
+
+	/** Number of elements */
+	size_type count;
+
+	/** Number of slots which are not empty, this includes the slots of erased elements */
+	size_type used;
+
+	static K Erased() { return reinterpret_cast<K>(static_cast<size_t>(1)); }
+
+	static bool IsElement(const value_type& slot)
+	{
+		return ((slot.first != NULL) && (slot.first != Erased()));
+	}
+
+	/** Find the first slot to probe for a key
+	 * @param key The key to find
+	 * @param mask capacity - 1
+	 * @return The slot index
+	 */
+	static size_type Hash(K key, size_type mask)
+	{
+		// The low bits of a heap pointer are mostly zero due to alignment, mix them with the high bits
+		size_t val = reinterpret_cast<size_t>(key);
+		val ^= (val >> 4) ^ (val >> 16);
+		return (val * 2654435761U) & mask;
+	}
+
+	/** Find the slot of a key
+	 * @param key The key to find
+	 * @return The slot of the key, or NULL if the key is not in the map
+	 */
+	value_type* FindSlot(K key) const
+	{
+		if (!count)
+			return NULL;
+
+		const size_type mask = capacity - 1;
+		for (size_type pos = Hash(key, mask); ; pos = (pos + 1) & mask)
+		{
+			value_type& slot = slots[pos];
+			if (slot.first == key)
+				return &slot;
+			if (slot.first == NULL)
+				return NULL;
+		}
+	}
+
+	/** Resize the array and move the elements into it, dropping the slots of erased elements
+	 * @param newcapacity The new number of slots, must be a power of two larger than count
+	 */
+	void Rehash(size_type newcapacity)
+	{
+		value_type* const oldslots = slots;
+		const size_type oldcapacity = capacity;
+
+		slots = new value_type[newcapacity];
+		capacity = newcapacity;
+		used = count;
+
+		const size_type mask = capacity - 1;
+		for (size_type i = 0; i < oldcapacity; i++)
+		{
+			if (!IsElement(oldslots[i]))
+				continue;
+
+			size_type pos = Hash(oldslots[i].first, mask);
+			while (slots[pos].first != NULL)
+				pos = (pos + 1) & mask;
+			slots[pos] = oldslots[i];
+		}
+		delete[] oldslots;
+	}
+
+	// Non-copyable
+	pointer_map(const pointer_map&);
+	pointer_map& operator=(const pointer_map&);
+
+ public:
+	template <typename Slot>
+	class iterator_base
+	{
+		Slot* slot;
+		Slot* last;
+
+		void SkipEmpty()
+		{
+			while ((slot != last) && (!IsElement(*slot)))
+				++slot;
+		}
+
+	 public:
+		iterator_base() : slot(NULL), last(NULL) { }
+
+		iterator_base(Slot* first, Slot* end) : slot(first), last(end)
+		{
+			SkipEmpty();
+		}
+
+		template <typename OtherSlot>
+		iterator_base(const iterator_base<OtherSlot>& other) : slot(other.get_slot()), last(other.get_last()) { }
+
+		Slot* get_slot() const { return slot; }
+		Slot* get_last() const { return last; }
+
+		Slot& operator*() const { return *slot; }
+		Slot* operator->() const { return slot; }
+
+		iterator_base& operator++()
+		{
+			++slot;
+			SkipEmpty();
+			return *this;
+		}
+
+		iterator_base operator++(int)
+		{
+			iterator_base ret(*this);
+			++*this;
+			return ret;
+		}
+
+		template <typename OtherSlot>
+		bool operator==(const iterator_base<OtherSlot>& other) const { return (slot == other.get_slot()); }
+
+		template <typename OtherSlot>
+		bool operator!=(const iterator_base<OtherSlot>& other) const { return (slot != other.get_slot()); }
+	};
+
+	typedef iterator_base<value_type> iterator;
+	typedef iterator_base<const value_type> const_iterator;
+
+	pointer_map()
+		: slots(NULL)
+		, capacity(0)
+		, count(0)
+		, used(0)
+	{
+	}
+
+	~pointer_map()
+	{
+		delete[] slots;
+	}
+
+	iterator begin() { return iterator(slots, slots + capacity); }
+	iterator end() { return iterator(slots + capacity, slots + capacity); }
+	const_iterator begin() const { return const_iterator(slots, slots + capacity); }
+	const_iterator end() const { return const_iterator(slots + capacity, slots + capacity); }
+
+	size_type size() const { return count; }
+	bool empty() const { return (count == 0); }
+
+	iterator find(K key)
+	{
+		value_type* slot = FindSlot(key);
+		return (slot ? iterator(slot, slots + capacity) : end());
+	}
+
+	const_iterator find(K key) const
+	{
+		const value_type* slot = FindSlot(key);
+		return (slot ? const_iterator(slot, slots + capacity) : end());
+	}
+
+	/** Insert an element if its key is not in the map yet
+	 * @param val The element to insert
+	 * @return The element with the key of val, and true if val was inserted
+	 */
+	std::pair<iterator, bool> insert(const value_type& val)
+	{
+		value_type* slot = FindSlot(val.first);
+		if (slot)
+			return std::make_pair(iterator(slot, slots + capacity), false);
+
+		// Keep at least half of the slots empty so probe sequences stay short
+		if ((used + 1) * 2 > capacity)
+		{
+			size_type newcapacity = 8;
+			while ((count + 1) * 4 > newcapacity)
+				newcapacity *= 2;
+			Rehash(newcapacity);
+		}
+
+		const size_type mask = capacity - 1;
+		size_type pos = Hash(val.first, mask);
+		while (IsElement(slots[pos]))
+			pos = (pos + 1) & mask;
+
+		if (slots[pos].first == NULL)
+			used++;
+		slots[pos] = val;
+		count++;
+		return std::make_pair(iterator(slots + pos, slots + capacity), true);
+	}
+
+	/** Erase an element, other iterators remain valid
+	 * @param it The element to erase, must be valid
+	 */
+	void erase(const iterator& it)
+	{
+		// The slot must stay non-empty so that probe sequences running through it do not end early
+		it->first = Erased();
+		it->second = V();
+		count--;
+	}
+
+	/** Erase the element with the given key
+	 * @param key The key to erase
+	 * @return The number of elements erased, 0 or 1
+	 */
+	size_type erase(K key)
+	{
+		iterator it = find(key);
+		if (it == end())
+			return 0;
+		erase(it);
+		return 1;
+	}
+};
+
+} // namespace insp
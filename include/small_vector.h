@@ -0,0 +1,84 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <vector>
+
+namespace insp
+{
+
+/** A sequence container which stores its first N elements inside the object itself.
+ * Only the elements beyond the first N are stored on the heap, so a small_vector that
+ * lives on the stack and usually holds no more than N elements does not allocate.
+ * The interface is a subset of std::vector.
+ * @tparam T The element type, should be cheap to copy and default construct
+ * @tparam N The number of elements stored inside the object
+ */
+template <typename T, size_t N>
+class small_vector
+{
+ public:
+	typedef T value_type;
+	typedef size_t size_type;
+
+ private:
+	/** The first N elements */
+	T inlinedata[N];
+
+	/** The elements after the first N */
+	std::vector<T> overflow;
+
+	/** Number of elements */
+	size_type count;
+
+ public:
+	small_vector() : count(0) { }
+
+	size_type size() const { return count; }
+	bool empty() const { return (count == 0); }
+
+	T& operator[](size_type index) { return (index < N ? inlinedata[index] : overflow[index - N]); }
+	const T& operator[](size_type index) const { return (index < N ? inlinedata[index] : overflow[index - N]); }
+
+	T& back() { return (*this)[count - 1]; }
+	const T& back() const { return (*this)[count - 1]; }
+
+	void push_back(const T& val)
+	{
+		if (count < N)
+			inlinedata[count] = val;
+		else
+			overflow.push_back(val);
+		count++;
+	}
+
+	void pop_back()
+	{
+		count--;
+		if (count >= N)
+			overflow.pop_back();
+	}
+
+	void clear()
+	{
+		overflow.clear();
+		count = 0;
+	}
+};
+
+} // namespace insp
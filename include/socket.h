@@ -80,7 +80,8 @@ namespace irc
 			/** Raw bits. Unused bits must be zero */
 			unsigned char bits[16];
 
-			cidr_mask() {}
+			/** Construct a CIDR mask which does not match any address */
+			cidr_mask() : type(AF_UNSPEC), length(0) {}
 			/** Construct a CIDR mask from the string. Will normalize (127.0.0.1/8 => 127.0.0.0/8). */
 			cidr_mask(const std::string& mask);
 			/** Construct a CIDR mask of a given length from the given address */
@@ -89,7 +90,9 @@ namespace irc
 			bool operator==(const cidr_mask& other) const;
 			/** Ordering defined for maps */
 			bool operator<(const cidr_mask& other) const;
-			/** Match within this CIDR? */
+			/** Match within this CIDR? This only compares the bits of the address
+			 * covered by the mask and does not build a temporary mask.
+			 */
 			bool match(const irc::sockets::sockaddrs& addr) const;
 			/** Human-readable string */
 			std::string str() const;
@@ -109,6 +112,15 @@ namespace irc
 		 */
 		CoreExport bool MatchCIDR(const std::string &address, const std::string &cidr_mask, bool match_with_username);
 
+		/** Parse a human-readable CIDR mask, for example 1.2.0.0/16, once so that it can be
+		 * matched against binary addresses with cidr_mask::match(). The mask is only accepted
+		 * if MatchCIDR() would treat it as a CIDR mask.
+		 * @param mask The human readable mask, without a username part
+		 * @param cidr The structure to place the result in, not changed if the mask is invalid
+		 * @return True if the mask is a valid CIDR mask of an IPv4 or IPv6 address
+		 */
+		CoreExport bool ParseCIDR(const std::string& mask, cidr_mask& cidr);
+
 		/** Convert an address-port pair into a binary sockaddr
 		 * @param addr The IP address, IPv4 or IPv6
 		 * @param port The port, 0 for unspecified
@@ -147,9 +159,21 @@ class CoreExport ListenSocket : public EventHandler
 	 */
 	dynamic_reference_nocheck<IOHookProvider> iohookprov;
 
+	/** Number of connections accepted and handed over to the user manager or a module */
+	unsigned long accepted;
+
+	/** Number of connections which could not be accepted or were refused */
+	unsigned long rejected;
+
+	/** Number of times the accept queue was emptied before the accept batch limit was reached */
+	unsigned long drained;
+
 	/** Create a new listening socket
+	 * @param tag The bind tag this socket is created for
+	 * @param bind_to The address to bind to
+	 * @param reuseport True to set SO_REUSEPORT so the address can be shared with other listening sockets
 	 */
-	ListenSocket(ConfigTag* tag, const irc::sockets::sockaddrs& bind_to);
+	ListenSocket(ConfigTag* tag, const irc::sockets::sockaddrs& bind_to, bool reuseport = false);
 	/** Handle an I/O event
 	 */
 	void HandleEvent(EventType et, int errornum = 0);
@@ -157,9 +181,11 @@ class CoreExport ListenSocket : public EventHandler
 	 */
 	~ListenSocket();
 
-	/** Handles sockets internals crap of a connection, convenience wrapper really
+	/** Accept a single pending connection and hand it over to whoever handles it
+	 * @return True if the accept queue may have more connections waiting, false if it is
+	 * empty or accept() failed
 	 */
-	void AcceptInternal();
+	bool AcceptInternal();
 
 	/** Inspects the bind block belonging to this socket to set the name of the IO hook
 	 * provider which this socket will use for incoming connections.
@@ -29,6 +29,10 @@
 #include "socket.h"
 #include "base.h"
 
+#ifndef DISABLE_WRITEV
+struct iovec;
+#endif
+
 /** Types of event an EventHandler may receive.
  * EVENT_READ is a readable file descriptor,
  * and EVENT_WRITE is a writeable file descriptor.
@@ -139,7 +143,12 @@ enum EventMask
 	FD_WRITE_WILL_BLOCK = 0x8000,
 
 	/** Mask for trial read/trial write */
-	FD_TRIAL_NOTE_MASK = 0x5000
+	FD_TRIAL_NOTE_MASK = 0x5000,
+
+	/** Set by SocketEngine::DetachFd(). The socket engine does not wait for events on
+	 * this file descriptor, changes to the read and write state are only recorded.
+	 */
+	FD_DETACHED = 0x10000
 };
 
 /** This class is a basic I/O handler class.
@@ -280,9 +289,10 @@ class CoreExport SocketEngine
 	/** Current number of descriptors in the engine
 	 */
 	static size_t CurrentSetSize;
-	/** List of handlers that want a trial read/write
+	/** List of handlers that want a trial read/write, this is the list of sockets which are
+	 * flushed at the end of the mainloop iteration. Each fd is added at most once.
 	 */
-	static std::set<int> trials;
+	static std::vector<int> trials;
 
 	static int MAX_DESCRIPTORS;
 
@@ -298,6 +308,11 @@ class CoreExport SocketEngine
 
 	static void DelFdRef(EventHandler* eh);
 
+	/** Get the maximum number of milliseconds DispatchEvents() may wait for events
+	 * without delaying a timer or the once a second work done by the mainloop
+	 */
+	static int GetDispatchTimeout();
+
 	template <typename T>
 	static void ResizeDouble(std::vector<T>& vect)
 	{
@@ -368,6 +383,19 @@ public:
 	 */
 	static void DelFd(EventHandler* eh);
 
+	/** Stop waiting for events on a file descriptor because another thread does the I/O on it.
+	 * The event handler stays in the reference table so GetRef() and trial reads and writes
+	 * keep working, but the socket engine no longer reports events for it.
+	 * Remove it with DelDetachedFd(), not DelFd().
+	 * @param eh The event handler to detach
+	 */
+	static void DetachFd(EventHandler* eh);
+
+	/** Remove an event handler which was detached with DetachFd() from the reference table
+	 * @param eh The event handler to remove
+	 */
+	static void DelDetachedFd(EventHandler* eh);
+
 	/** Returns true if a file descriptor exists in
 	 * the socket engine's list.
 	 * @param fd The event handler to look for
@@ -408,6 +436,7 @@ public:
 	 * @param addr The client IP address and port
 	 * @param addrlen The size of the sockaddr parameter.
 	 * @return This method should return exactly the same values as the system call it emulates.
+	 * Where accept4() is available the new socket is already non-blocking and close-on-exec.
 	 */
 	static int Accept(EventHandler* fd, sockaddr *addr, socklen_t *addrlen);
 
@@ -434,6 +463,17 @@ public:
 	 */
 	static int Send(EventHandler* fd, const void *buf, size_t len, int flags);
 
+#ifndef DISABLE_WRITEV
+	/** Abstraction for writev(2).
+	 * This function should emulate its namesake system call exactly.
+	 * @param fd This version of the call takes an EventHandler instead of a bare file descriptor.
+	 * @param iov The buffers in which the data that is sent is stored.
+	 * @param iovcnt The number of buffers.
+	 * @return This method should return exactly the same values as the system call it emulates.
+	 */
+	static int WriteV(EventHandler* fd, const iovec* iov, int iovcnt);
+#endif
+
 	/** Abstraction for BSD sockets recv(2).
 	 * This function should emulate its namesake system call exactly.
 	 * @param fd This version of the call takes an EventHandler instead of a bare file descriptor.
@@ -534,6 +574,13 @@ public:
 	 */
 	static const Statistics& GetStats() { return stats; }
 
+	/** Account for data which was transferred without going through Recv() or Send(),
+	 * e.g. by an I/O thread
+	 * @param len_in Bytes received
+	 * @param len_out Bytes sent
+	 */
+	static void UpdateStats(size_t len_in, size_t len_out) { stats.Update(len_in, len_out); }
+
 	/** Should we ignore the error in errno?
 	 * Checks EAGAIN and WSAEWOULDBLOCK
 	 */
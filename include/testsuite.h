@@ -30,7 +30,10 @@ class TestSuite
 	bool DoWildTests();
 	bool DoCommaSepStreamTests();
 	bool DoSpaceSepStreamTests();
+	bool DoTokenizeTests();
 	bool DoGenerateUIDTests();
+	bool DoMemberMapBenchmark();
+	bool DoTimerTests();
 };
 
 #endif
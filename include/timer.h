@@ -23,30 +23,36 @@
 
 class Module;
 
-/** Timer class for one-second resolution timers
+/** Timer class for one-shot and repeating timers
  * Timer provides a facility which allows module
  * developers to create one-shot timers. The timer
- * can be made to trigger at any time up to a one-second
+ * can be made to trigger at any time up to a one-millisecond
  * resolution. To use Timer, inherit a class from
  * Timer, then insert your inherited class into the
  * queue using Server::AddTimer(). The Tick() method of
  * your object (which you have to override) will be called
  * at the given time.
  */
-class CoreExport Timer
+class CoreExport Timer : public insp::intrusive_list_node<Timer>
 {
-	/** The triggering time
+	/** The triggering time, in milliseconds on the clock returned by TimerManager::GetTime()
 	 */
-	time_t trigger;
+	uint64_t expiry;
 
-	/** Number of seconds between triggers
+	/** Number of milliseconds between triggers
 	 */
-	unsigned int secs;
+	unsigned long interval;
 
 	/** True if this is a repeating timer
 	 */
 	bool repeat;
 
+	/** The TimerManager wheel slot this timer is in, NULL if it is not scheduled
+	 */
+	insp::intrusive_list<Timer>* slot;
+
+	friend class TimerManager;
+
  public:
 	/** Default constructor, initializes the triggering time
 	 * @param secs_from_now The number of seconds from now to trigger the timer
@@ -59,25 +65,25 @@ class CoreExport Timer
 	virtual ~Timer();
 
 	/** Retrieve the current triggering time
+	 * @return The time (as returned by InspIRCd::Time()) at which this timer triggers
 	 */
-	time_t GetTrigger() const
-	{
-		return trigger;
-	}
+	time_t GetTrigger() const;
 
 	/** Sets the trigger timeout to a new value
 	 * This does not update the bookkeeping in TimerManager, use SetInterval()
 	 * to change the interval between ticks while keeping TimerManager updated
 	 */
-	void SetTrigger(time_t nexttrigger)
-	{
-		trigger = nexttrigger;
-	}
+	void SetTrigger(time_t nexttrigger);
 
 	/** Sets the interval between two ticks.
 	 */
 	void SetInterval(time_t interval);
 
+	/** Sets the interval between two ticks in milliseconds and (re)schedules
+	 * the timer to trigger that many milliseconds from now.
+	 */
+	void SetIntervalMs(unsigned long msecs);
+
 	/** Called when the timer ticks.
 	 * You should override this method with some useful code to
 	 * handle the tick event.
@@ -98,7 +104,15 @@ class CoreExport Timer
 	 */
 	unsigned int GetInterval() const
 	{
-		return secs;
+		return interval / 1000;
+	}
+
+	/** Returns the interval (number of milliseconds between ticks)
+	 * of this timer object.
+	 */
+	unsigned long GetIntervalMs() const
+	{
+		return interval;
 	}
 
 	/** Cancels the repeat state of a repeating timer.
@@ -114,21 +128,91 @@ class CoreExport Timer
 /** This class manages sets of Timers, and triggers them at their defined times.
  * This will ensure timers are not missed, as well as removing timers that have
  * expired and allowing the addition of new ones.
+ *
+ * Timers are kept in a hierarchical timing wheel: the first wheel has a slot for
+ * each of the next 256 milliseconds, and each following wheel has 64 slots that each
+ * cover a whole rotation of the previous wheel. Adding and removing a timer is O(1);
+ * when the first wheel wraps around, the timers in the next slot of the second wheel
+ * are moved down into it, and so on.
  */
 class CoreExport TimerManager
 {
-	typedef std::multimap<time_t, Timer*> TimerMap;
+	typedef insp::intrusive_list<Timer> TimerList;
+
+	/** Number of bits of the time covered by the first wheel */
+	static const unsigned int ROOT_BITS = 8;
+
+	/** Number of bits of the time covered by each of the other wheels */
+	static const unsigned int LEVEL_BITS = 6;
+
+	/** Number of wheels after the first one */
+	static const unsigned int LEVELS = 4;
+
+	static const unsigned int ROOT_SIZE = 1 << ROOT_BITS;
+	static const unsigned int LEVEL_SIZE = 1 << LEVEL_BITS;
 
-	/** A list of all pending timers
+	/** The first wheel, one slot per millisecond */
+	TimerList root[ROOT_SIZE];
+
+	/** The other wheels */
+	TimerList levels[LEVELS][LEVEL_SIZE];
+
+	/** The time of the next root wheel slot to run; all timers before this have been run */
+	uint64_t current;
+
+	/** While TickTimers() runs timers, the first slot after the ones it runs in this call; otherwise 0 */
+	uint64_t nextpass;
+
+	/** Number of scheduled timers */
+	size_t count;
+
+	/** Number of timers which have ticked during the second in expiredtime */
+	unsigned long expired;
+
+	/** Number of timers which ticked during the last full second */
+	unsigned long lastexpired;
+
+	/** The second in which the timers counted in expired have ticked */
+	time_t expiredtime;
+
+	/** Put a timer into the slot that matches its expiry time */
+	void Schedule(Timer* t);
+
+	/** Move the timers in the current slot of a wheel down to the lower wheels
+	 * @param level The wheel to cascade, 0 is the one after the root wheel
+	 * @return The index of the slot which was cascaded
 	 */
-	TimerMap Timers;
+	unsigned int Cascade(unsigned int level);
 
  public:
+	TimerManager();
+
+	/** Get the current time on the monotonic clock used by timers
+	 * @return The number of milliseconds since an unspecified starting point
+	 */
+	static uint64_t GetTime();
+
 	/** Tick all pending Timers
 	 * @param TIME the current system time
 	 */
 	void TickTimers(time_t TIME);
 
+	/** Get the number of milliseconds until the next timer may need to run
+	 * @param max The value to return if there is no timer due sooner
+	 * @return Number of milliseconds to wait, between 0 and max
+	 */
+	long GetNextTimeout(long max) const;
+
+	/** Get the number of scheduled timers
+	 * @return The number of timers waiting to tick
+	 */
+	size_t GetTimerCount() const { return count; }
+
+	/** Get the number of timers which ticked during the last second
+	 * @return The number of timer expirations per second
+	 */
+	unsigned long GetExpiredPerSecond() const;
+
 	/** Add an Timer
 	 * @param T an Timer derived class to add
 	 */
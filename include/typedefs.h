@@ -42,6 +42,7 @@ class ServerConfig;
 class ServerLimits;
 class Thread;
 class User;
+class WildcardMask;
 class XLine;
 class XLineManager;
 class XLineFactory;
@@ -61,6 +62,12 @@ typedef std::vector<std::pair<std::string, std::string> > FailedPortList;
  */
 typedef std::vector<Membership*> IncludeChanList;
 
+/** Users whose inclusion in the neighbor list of a user is decided by a module instead of by the
+ * channels they share with the user, the value is true to include the user and false to exclude it.
+ * Usually only a few users are excepted, so they are kept in a sorted vector.
+ */
+typedef insp::flat_map<User*, bool> NeighborExceptions;
+
 /** A cached text file stored with its contents as lines
  */
 typedef std::vector<std::string> file_cache;
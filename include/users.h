@@ -28,6 +28,7 @@
 #include "inspsocket.h"
 #include "mode.h"
 #include "membership.h"
+#include "timer.h"
 
 /** connect class types
  */
@@ -85,6 +86,10 @@ struct CoreExport ConnectClass : public refcountbase
 	 */
 	std::string host;
 
+	/** The part of the host mask after the last '@' parsed as a CIDR mask, matches no address if it is not one
+	 */
+	irc::sockets::cidr_mask hostcidr;
+
 	/** Number of seconds between pings for this line
 	 */
 	unsigned int pingtime;
@@ -216,6 +221,8 @@ struct CoreExport ConnectClass : public refcountbase
  * connection is stored here primarily, from the user's socket ID (file descriptor) through to the
  * user's nickname and hostname.
  */
+typedef unsigned int already_sent_t;
+
 class CoreExport User : public Extensible
 {
  private:
@@ -294,6 +301,11 @@ class CoreExport User : public Extensible
 	 */
 	std::string dhost;
 
+	/** Incremented whenever the nick, ident, host, IP or real name of the user changes.
+	 * Membership::IsBanned() compares this to the value it cached its verdict at.
+	 */
+	unsigned long identitygeneration;
+
 	/** The users full name (GECOS).
 	 */
 	std::string fullname;
@@ -379,6 +391,7 @@ class CoreExport User : public Extensible
 
 	/** This clears any cached results that are used for GetFullRealHost() etc.
 	 * The results of these calls are cached as generating them can be generally expensive.
+	 * It also invalidates the ban verdicts cached in the memberships of the user.
 	 */
 	void InvalidateCache();
 
@@ -542,6 +555,29 @@ class CoreExport User : public Extensible
 	 */
 	void WriteCommonQuit(const std::string &normal_text, const std::string &oper_text);
 
+	/** Handler which is called for every local neighbor of a user by ForEachNeighbor()
+	 */
+	class ForEachNeighborHandler
+	{
+	 public:
+		virtual ~ForEachNeighborHandler() { }
+
+		/** Called once for every local user who is a neighbor of the user ForEachNeighbor() was called on
+		 * @param user The neighbor
+		 */
+		virtual void Execute(LocalUser* user) = 0;
+	};
+
+	/** Call a handler for every local user who shares a channel with this user, taking the channels and
+	 * exceptions set by modules in OnBuildNeighborList into account. Every neighbor is visited once, no
+	 * matter how many channels it shares with this user; this is tracked with LocalUser::already_sent
+	 * so no set of visited users has to be built.
+	 * @param handler The handler to call
+	 * @param include_self True to visit this user as well if it is local
+	 * @return The value LocalUser::already_sent was set to for every local user who was visited or excluded
+	 */
+	already_sent_t ForEachNeighbor(ForEachNeighborHandler& handler, bool include_self = true);
+
 	/** Dump text to a user target, splitting it appropriately to fit
 	 * @param linePrefix text to prefix each complete line with
 	 * @param textStream the text to send to the user
@@ -572,6 +608,14 @@ class CoreExport User : public Extensible
 	 */
 	bool ChangeDisplayedHost(const std::string& host);
 
+	/** Change the real host of a user.
+	 * ALWAYS use this function, rather than writing User::host directly,
+	 * as this keeps the index of local users which new X-lines are applied with up to date.
+	 * @param newhost The new real hostname to set
+	 * @param resetdisplay If true, the displayed host is changed to the new real host too
+	 */
+	void ChangeRealHost(const std::string& newhost, bool resetdisplay);
+
 	/** Change the ident (username) of a user.
 	 * ALWAYS use this function, rather than writing User::ident directly,
 	 * as this triggers module events allowing the change to be syncronized to
@@ -621,9 +665,81 @@ class CoreExport UserIOHandler : public StreamSocket
 	 * @param data The data to add to the write buffer
 	 */
 	void AddWriteBuf(const std::string &data);
+
+	/** Adds a buffer which may be shared with other users to the user's write buffer.
+	 * The same sendq limits apply as for AddWriteBuf(const std::string&).
+	 * @param buffer The buffer to add to the write buffer
+	 */
+	void AddWriteBuf(const reference<SendBuffer>& buffer);
 };
 
-typedef unsigned int already_sent_t;
+/** Handles the registration timeout, pings and ping timeout of a local user.
+ * Each local user has exactly one of these scheduled at the time their next check is due,
+ * so users who have nothing due cost nothing. Activity only moves LocalUser::nping forward,
+ * the timer notices that when it ticks and schedules itself again for the new time.
+ */
+class CoreExport UserTimeoutTimer : public Timer
+{
+	LocalUser* const user;
+
+ public:
+	UserTimeoutTimer(LocalUser* me) : Timer(1), user(me) { }
+	bool Tick(time_t TIME) CXX11_OVERRIDE;
+};
+
+/** Resumes processing the queued commands of a local user when their flood penalty allows it.
+ * This is only scheduled while the user has a complete line waiting in their recvq which could
+ * not be processed, so users with no penalty or no queued commands cost nothing.
+ */
+class CoreExport FakeLagTimer : public Timer
+{
+	LocalUser* const user;
+
+ public:
+	FakeLagTimer(LocalUser* me) : Timer(1), user(me) { }
+	bool Tick(time_t TIME) CXX11_OVERRIDE;
+};
+
+/** Builds a line to send to local users directly in the SendBuffer which is queued on their sockets.
+ * The prefix, the text and the line terminator are written into the buffer once, instead of being
+ * assembled in temporary strings first, and the finished line can be written to any number of
+ * users with LocalUser::Write().
+ */
+class CoreExport LineBuilder
+{
+	/** The buffer the line is built in */
+	reference<SendBuffer> buffer;
+
+ public:
+	/** Start a line with no prefix
+	 */
+	LineBuilder();
+
+	/** Start a line with a prefix
+	 * @param source The source of the line, the line starts with ":<source> "
+	 */
+	explicit LineBuilder(const std::string& source);
+
+	/** Append text to the line
+	 * @param text The text to append
+	 * @return This builder
+	 */
+	LineBuilder& Append(const std::string& text) { buffer->data.append(text); return *this; }
+	LineBuilder& Append(const char* text) { buffer->data.append(text); return *this; }
+	LineBuilder& Append(char chr) { buffer->data.push_back(chr); return *this; }
+
+	/** Append a numeric, padded with zeros to three digits
+	 * @param numeric The numeric to append
+	 * @return This builder
+	 */
+	LineBuilder& AppendNumeric(unsigned int numeric);
+
+	/** Finish the line by cropping it to the maximum line length and appending CR/LF.
+	 * Nothing may be appended to the line afterwards.
+	 * @return The line, ready to be written to users
+	 */
+	const reference<SendBuffer>& Finish();
+};
 
 class CoreExport LocalUser : public User, public InviteBase<LocalUser>, public insp::intrusive_list_node<LocalUser>
 {
@@ -633,6 +749,14 @@ class CoreExport LocalUser : public User, public InviteBase<LocalUser>, public i
 
 	UserIOHandler eh;
 
+	/** Checks the registration timeout and ping of this user when they are due
+	 */
+	UserTimeoutTimer timeouttimer;
+
+	/** Processes the queued commands of this user once their flood penalty has decayed enough
+	 */
+	FakeLagTimer fakelagtimer;
+
 	/** Stats counter for bytes inbound
 	 */
 	unsigned int bytes_in;
@@ -704,6 +828,12 @@ class CoreExport LocalUser : public User, public InviteBase<LocalUser>, public i
 	 */
 	unsigned int CommandFloodPenalty;
 
+	/** The time, in milliseconds on the clock returned by TimerManager::GetTime(), up to
+	 * which CommandFloodPenalty has been decayed. The penalty decays by the command rate of
+	 * the user's connect class every second and is brought up to date when they send data.
+	 */
+	uint64_t penaltytime;
+
 	static already_sent_t already_sent_id;
 	already_sent_t already_sent;
 
@@ -718,6 +848,13 @@ class CoreExport LocalUser : public User, public InviteBase<LocalUser>, public i
 	 */
 	void FullConnect();
 
+	/** Check again whether this unregistered user can be fully connected.
+	 * Unregistered users are only checked when their registration times out, so a module
+	 * which holds a user back in OnCheckReady() must call this when it might stop doing so.
+	 * @param secs Number of seconds to wait before checking, 0 to check on the next timer tick
+	 */
+	void CheckReady(unsigned int secs = 0);
+
 	/** Set the connect class to which this user belongs to.
 	 * @param explicit_name Set this string to tie the user to a specific class name. Otherwise, the class is fitted by checking \<connect> tags from the configuration file.
 	 * @return A reference to this user's current connect class.
@@ -732,6 +869,19 @@ class CoreExport LocalUser : public User, public InviteBase<LocalUser>, public i
 	void Write(const std::string& text);
 	void Write(const char*, ...) CUSTOM_PRINTF(2, 3);
 
+	/** Write a line created by MakeLine() to this user. This does not copy the line, so
+	 * when the same line is sent to many users it is only allocated once.
+	 * @param line The line to send
+	 */
+	void Write(const reference<SendBuffer>& line);
+
+	/** Create a line which can be sent to any number of local users with Write(const reference<SendBuffer>&).
+	 * Use LineBuilder instead to avoid copying the line when it has to be assembled from several parts.
+	 * @param text The text of the line, without CR/LF. It is cropped to the maximum line length.
+	 * @return A new buffer containing the line with CR/LF appended
+	 */
+	static reference<SendBuffer> MakeLine(const std::string& text);
+
 	/** Returns the list of channels this user has been invited to but has not yet joined.
 	 * @return A list of channels the user is invited to
 	 */
@@ -0,0 +1,126 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+/** A glob pattern which has been prepared for matching many strings against it.
+ * The pattern is case folded once and split at each '*' into literal segments, so
+ * matching a string folds the string once and then only has to find each segment
+ * in it, instead of walking the pattern through the case map at every backtrack
+ * like InspIRCd::Match() does. The result is always the same as InspIRCd::Match()
+ * with the same pattern and map.
+ */
+class CoreExport WildcardMask
+{
+	/** A part of the pattern between two '*' characters
+	 */
+	struct Segment
+	{
+		/** Offset of the segment in folded */
+		std::string::size_type pos;
+
+		/** Length of the segment */
+		std::string::size_type len;
+
+		/** Offset of the first character in the segment which is not a '?', or len if there is none */
+		std::string::size_type first;
+
+		/** True if the segment contains a '?' */
+		bool wild;
+	};
+
+	/** The pattern as given to the constructor
+	 */
+	std::string mask;
+
+	/** The pattern with every character except the wildcards case folded, and the '*' characters removed
+	 */
+	std::string folded;
+
+	/** The segments of folded, empty segments are left out unless the pattern has no '*'
+	 */
+	std::vector<Segment> segments;
+
+	/** The case map the pattern was folded with
+	 */
+	const unsigned char* map;
+
+	/** True if the pattern was compiled with national_case_insensitive_map
+	 */
+	bool national;
+
+	/** True if the pattern does not start with a '*'; the first segment must match at the start of the string
+	 */
+	bool anchorstart;
+
+	/** True if the pattern does not end with a '*'; the last segment must match at the end of the string
+	 */
+	bool anchorend;
+
+	/** True if the pattern has no '*'; the only segment must match the whole string
+	 */
+	bool exact;
+
+	/** The shortest string which can match the pattern
+	 */
+	std::string::size_type minlen;
+
+	/** Check if a segment matches a string at the given position
+	 * @param seg The segment to check
+	 * @param str The string, at least seg.len characters long
+	 * @param casemap The map to fold the characters of str with, rfc_case_sensitive_map if str is already folded
+	 * @return True if the segment matches
+	 */
+	bool MatchSegment(const Segment& seg, const unsigned char* str, const unsigned char* casemap) const;
+
+	/** Find the first position at which a segment matches a folded string
+	 * @param seg The segment to find
+	 * @param str The folded string
+	 * @param len Length of str
+	 * @return The position of the segment in str, or NULL if it does not occur in it
+	 */
+	const unsigned char* FindSegment(const Segment& seg, const unsigned char* str, std::string::size_type len) const;
+
+ public:
+	/** Create a pattern which only matches the empty string
+	 */
+	WildcardMask();
+
+	/** Compile a pattern
+	 * @param pattern The glob pattern
+	 * @param casemap The character map to match with. If NULL, the national case map is used.
+	 */
+	WildcardMask(const std::string& pattern, const unsigned char* casemap = NULL);
+
+	/** Check if a string matches the pattern
+	 * @param str The string to match
+	 * @return True if the string matches the pattern
+	 */
+	bool Match(const std::string& str) const { return Match(str.data(), str.length()); }
+
+	/** Check if a string matches the pattern
+	 * @param str The string to match, it does not have to be null terminated
+	 * @param len Length of str
+	 * @return True if the string matches the pattern
+	 */
+	bool Match(const char* str, std::string::size_type len) const;
+
+	/** Get the pattern this object was compiled from
+	 * @return The glob pattern
+	 */
+	const std::string& str() const { return mask; }
+};
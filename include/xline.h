@@ -111,6 +111,13 @@ class CoreExport XLine : public classbase
 	 */
 	virtual const std::string& Displayable() = 0;
 
+	/** Returns the mask which the host or IP of a user must match for this line
+	 * to match them. XLineManager uses this to index the line, so that Matches()
+	 * is only called on the lines which may match a user.
+	 * @return The host or IP mask, or NULL if the line does not match on the host
+	 */
+	virtual const std::string* GetHostMask() { return NULL; }
+
 	/** Called when the xline has just been added.
 	 */
 	virtual void OnAdd() { }
@@ -159,9 +166,11 @@ class CoreExport KLine : public XLine
 	 */
 	KLine(time_t s_time, long d, std::string src, std::string re, std::string ident, std::string host)
 		: XLine(s_time, d, src, re, "K"), identmask(ident), hostmask(host)
+		, identmatcher(ident, ascii_case_insensitive_map), hostmatcher(host, ascii_case_insensitive_map)
 	{
 		matchtext = this->identmask;
 		matchtext.append("@").append(this->hostmask);
+		irc::sockets::ParseCIDR(this->hostmask, hostcidr);
 	}
 
 	/** Destructor
@@ -178,6 +187,8 @@ class CoreExport KLine : public XLine
 
 	virtual const std::string& Displayable();
 
+	virtual const std::string* GetHostMask();
+
 	virtual bool IsBurstable();
 
 	/** Ident mask (ident part only)
@@ -188,6 +199,16 @@ class CoreExport KLine : public XLine
 	std::string hostmask;
 
 	std::string matchtext;
+
+	/** Ident mask compiled for matching
+	 */
+	WildcardMask identmatcher;
+	/** Host mask compiled for matching
+	 */
+	WildcardMask hostmatcher;
+	/** Host mask parsed as a CIDR mask, matches no address if it is not one
+	 */
+	irc::sockets::cidr_mask hostcidr;
 };
 
 /** GLine class
@@ -205,9 +226,11 @@ class CoreExport GLine : public XLine
 	 */
 	GLine(time_t s_time, long d, std::string src, std::string re, std::string ident, std::string host)
 		: XLine(s_time, d, src, re, "G"), identmask(ident), hostmask(host)
+		, identmatcher(ident, ascii_case_insensitive_map), hostmatcher(host, ascii_case_insensitive_map)
 	{
 		matchtext = this->identmask;
 		matchtext.append("@").append(this->hostmask);
+		irc::sockets::ParseCIDR(this->hostmask, hostcidr);
 	}
 
 	/** Destructor
@@ -224,6 +247,8 @@ class CoreExport GLine : public XLine
 
 	virtual const std::string& Displayable();
 
+	virtual const std::string* GetHostMask();
+
 	/** Ident mask (ident part only)
 	 */
 	std::string identmask;
@@ -232,6 +257,16 @@ class CoreExport GLine : public XLine
 	std::string hostmask;
 
 	std::string matchtext;
+
+	/** Ident mask compiled for matching
+	 */
+	WildcardMask identmatcher;
+	/** Host mask compiled for matching
+	 */
+	WildcardMask hostmatcher;
+	/** Host mask parsed as a CIDR mask, matches no address if it is not one
+	 */
+	irc::sockets::cidr_mask hostcidr;
 };
 
 /** ELine class
@@ -249,9 +284,11 @@ class CoreExport ELine : public XLine
 	 */
 	ELine(time_t s_time, long d, std::string src, std::string re, std::string ident, std::string host)
 		: XLine(s_time, d, src, re, "E"), identmask(ident), hostmask(host)
+		, identmatcher(ident, ascii_case_insensitive_map), hostmatcher(host, ascii_case_insensitive_map)
 	{
 		matchtext = this->identmask;
 		matchtext.append("@").append(this->hostmask);
+		irc::sockets::ParseCIDR(this->hostmask, hostcidr);
 	}
 
 	~ELine()
@@ -268,6 +305,8 @@ class CoreExport ELine : public XLine
 
 	virtual const std::string& Displayable();
 
+	virtual const std::string* GetHostMask();
+
 	/** Ident mask (ident part only)
 	 */
 	std::string identmask;
@@ -276,6 +315,16 @@ class CoreExport ELine : public XLine
 	std::string hostmask;
 
 	std::string matchtext;
+
+	/** Ident mask compiled for matching
+	 */
+	WildcardMask identmatcher;
+	/** Host mask compiled for matching
+	 */
+	WildcardMask hostmatcher;
+	/** Host mask parsed as a CIDR mask, matches no address if it is not one
+	 */
+	irc::sockets::cidr_mask hostcidr;
 };
 
 /** ZLine class
@@ -291,8 +340,9 @@ class CoreExport ZLine : public XLine
 	 * @param ip IP to match
 	 */
 	ZLine(time_t s_time, long d, std::string src, std::string re, std::string ip)
-		: XLine(s_time, d, src, re, "Z"), ipaddr(ip)
+		: XLine(s_time, d, src, re, "Z"), ipaddr(ip), ipmatcher(ip)
 	{
+		irc::sockets::ParseCIDR(this->ipaddr, ipcidr);
 	}
 
 	/** Destructor
@@ -309,9 +359,19 @@ class CoreExport ZLine : public XLine
 
 	virtual const std::string& Displayable();
 
+	virtual const std::string* GetHostMask();
+
 	/** IP mask (no ident part)
 	 */
 	std::string ipaddr;
+
+	/** IP mask compiled for matching
+	 */
+	WildcardMask ipmatcher;
+
+	/** IP mask parsed as a CIDR mask, matches no address if it is not one
+	 */
+	irc::sockets::cidr_mask ipcidr;
 };
 
 /** QLine class
@@ -327,7 +387,7 @@ class CoreExport QLine : public XLine
 	 * @param nickname Nickname to match
 	 */
 	QLine(time_t s_time, long d, std::string src, std::string re, std::string nickname)
-		: XLine(s_time, d, src, re, "Q"), nick(nickname)
+		: XLine(s_time, d, src, re, "Q"), nick(nickname), nickmatcher(nickname)
 	{
 	}
 
@@ -347,6 +407,10 @@ class CoreExport QLine : public XLine
 	/** Nickname mask
 	 */
 	std::string nick;
+
+	/** Nickname mask compiled for matching
+	 */
+	WildcardMask nickmatcher;
 };
 
 /** XLineFactory is used to generate an XLine pointer, given just the
@@ -391,6 +455,39 @@ class CoreExport XLineFactory
 	virtual ~XLineFactory() { }
 };
 
+class XLineIndex;
+class LocalUserIndex;
+
+/** Expires the lines of an XLineManager when their duration is over
+ */
+class CoreExport XLineExpiryTimer : public Timer
+{
+	XLineManager* const manager;
+
+ public:
+	XLineExpiryTimer(XLineManager* xlm)
+		: Timer(0, false), manager(xlm)
+	{
+	}
+
+	bool Tick(time_t TIME) CXX11_OVERRIDE;
+};
+
+/** Applies the pending lines of an XLineManager at the start of the next main loop iteration
+ */
+class CoreExport XLineApplyTimer : public Timer
+{
+	XLineManager* const manager;
+
+ public:
+	XLineApplyTimer(XLineManager* xlm)
+		: Timer(0, false), manager(xlm)
+	{
+	}
+
+	bool Tick(time_t TIME) CXX11_OVERRIDE;
+};
+
 /** XLineManager is a class used to manage glines, klines, elines, zlines and qlines,
  * or any other line created by a module. It also manages XLineFactory classes which
  * can generate a specialized XLine for use by another module.
@@ -413,6 +510,61 @@ class CoreExport XLineManager
 	 */
 	XLineContainer lookup_lines;
 
+	/** Indexes of the lines in lookup_lines, by line type
+	 */
+	std::map<std::string, XLineIndex*> line_indexes;
+
+	/** Lines which are not permanent, ordered by the time they expire at.
+	 * The expiry time of a line must not change while it is in here.
+	 */
+	std::set<std::pair<time_t, XLine*> > expiring_lines;
+
+	/** Expires the first line in expiring_lines
+	 */
+	XLineExpiryTimer expirytimer;
+
+	/** The time expirytimer is set to tick at, 0 if it is not scheduled
+	 */
+	time_t nextexpiry;
+
+	/** Schedule expirytimer for the first line in expiring_lines, unless it is already scheduled to tick earlier
+	 */
+	void ScheduleExpiry();
+
+	/** Lines with a wildcard host mask which are being applied to the local users, a few users at a time
+	 */
+	std::vector<XLine*> scanning_lines;
+
+	/** UUIDs of the local users which scanning_lines have not been applied to yet
+	 */
+	std::vector<std::string> scanning_users;
+
+	/** Applies pending_lines and scanning_lines
+	 */
+	XLineApplyTimer applytimer;
+
+	/** Apply the pending lines which have a host mask without wildcards to the local users they
+	 * match, and apply scanning_lines to the next few users. Pending lines with a wildcard host
+	 * mask become scanning_lines when the lines before them have been applied to every user.
+	 */
+	void ApplyPendingLines();
+
+	/** The local users by their host and IP, used to find the users a pending line with a host mask
+	 * without wildcards may match
+	 */
+	LocalUserIndex* localusers;
+
+	friend class XLineExpiryTimer;
+	friend class XLineApplyTimer;
+
+	/** Find the first line in an index which matches a user or a pattern
+	 * @param container Iterator to the lines of the type of the index
+	 * @param subject The user or pattern to match
+	 * @return The matching XLine, or NULL if there is no match
+	 */
+	template <typename T>
+	XLine* MatchIndex(ContainerIter container, T subject);
+
  public:
 
 	/** Constructor
@@ -423,6 +575,17 @@ class CoreExport XLineManager
 	 */
 	~XLineManager();
 
+	/** Add a local user to the index used to apply new lines, or update their entry after
+	 * their host or IP changed. Called by the core when a user connects or changes host or IP.
+	 * @param user The user to index
+	 */
+	void IndexLocalUser(LocalUser* user);
+
+	/** Remove a local user from the index used to apply new lines. Called by the core when a user quits.
+	 * @param user The user to remove
+	 */
+	void UnindexLocalUser(LocalUser* user);
+
 	/** Split an ident and host into two seperate strings.
 	 * This allows for faster matching.
 	 */
@@ -509,9 +672,15 @@ class CoreExport XLineManager
 	 */
 	void ExpireLine(ContainerIter container, LookupIter item);
 
+	/** Expire all lines which have expired. This is called by a timer when
+	 * the first line expires, lines are not expired when they are matched.
+	 */
+	void ExpireLines();
+
 	/** Apply any new lines that are pending to be applied.
 	 * This will only apply lines in the pending_lines list, to save on
-	 * CPU time.
+	 * CPU time. The lines are applied at the start of the next main loop
+	 * iteration, so that lines which are added together are applied together.
 	 */
 	void ApplyLines();
 
@@ -87,6 +87,10 @@ sub __get_template_settings($$$) {
 
 	# Miscellaneous information
 	$settings{CONFIGURE_CACHE_FILE} = CONFIGURE_CACHE_FILE;
+
+	# The io_uring socket engine submits the socket I/O to the ring, so it implements
+	# SocketEngine::Accept(), Recv(), Send() and WriteV() instead of src/socketengine.cpp.
+	$settings{SOCKETENGINE_OWNS_IO} = $config->{SOCKETENGINE} eq 'uring';
 	$settings{SYSTEM_NAME} = lc $^O;
 	chomp($settings{SYSTEM_NAME_VERSION} = `uname -sr 2>/dev/null`);
 
@@ -34,5 +34,9 @@
 #ifndef _WIN32
  %target include/config.h
  %define HAS_CLOCK_GETTIME
+ %define HAS_EPOLL
  %define HAS_EVENTFD
+ %define HAS_ACCEPT4
+ %define HAS_SENDMMSG
+ %define SOCKETENGINE_OWNS_IO
 #endif
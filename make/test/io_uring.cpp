@@ -0,0 +1,38 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+int main() {
+	io_uring_params params;
+	memset(&params, 0, sizeof(params));
+
+	// The engine needs buffer selection for recvs (Linux 5.7)
+	io_uring_sqe sqe;
+	sqe.poll32_events = 0;
+	sqe.opcode = IORING_OP_PROVIDE_BUFFERS;
+	sqe.flags = IOSQE_BUFFER_SELECT;
+	sqe.buf_group = 0;
+	sqe.accept_flags = 0;
+
+	int fd = syscall(__NR_io_uring_setup, 8, &params);
+	return (fd < 0);
+}
@@ -0,0 +1,28 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <sys/types.h>
+#include <sys/socket.h>
+
+int main() {
+	// There is nothing to send or receive here, this only checks that sendmmsg() and recvmmsg() exist.
+	mmsghdr msgs[1];
+	sendmmsg(-1, msgs, 0, 0);
+	recvmmsg(-1, msgs, 0, 0, 0);
+	return 0;
+}
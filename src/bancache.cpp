@@ -24,78 +24,127 @@ BanCacheHit::BanCacheHit(const std::string& type, const std::string& reason, tim
 	: Type(type)
 	, Reason(reason)
 	, Expiry(ServerInstance->Time() + seconds)
+	, Generation(0)
 {
 }
 
-BanCacheHit *BanCacheManager::AddHit(const std::string &ip, const std::string &type, const std::string &reason, time_t seconds)
+size_t BanCacheManager::RangeHash::operator()(const irc::sockets::cidr_mask& range) const
 {
-	BanCacheHit*& b = BanHash[ip];
-	if (b != NULL) // can't have two cache entries on the same IP, sorry..
+	size_t t = range.type * 131 + range.length;
+	for (unsigned int i = 0; i < sizeof(range.bits); i++)
+		t = 5 * t + range.bits[i];
+	return t;
+}
+
+unsigned long BanCacheManager::GetGeneration(const BanCacheHit* b) const
+{
+	if (!b->IsPositive())
+		return NegativeGeneration;
+
+	std::map<std::string, unsigned long>::const_iterator i = Generations.find(b->Type);
+	return (i == Generations.end()) ? 0 : i->second;
+}
+
+BanCacheHit *BanCacheManager::AddHit(const irc::sockets::cidr_mask& range, const std::string &type, const std::string &reason, time_t seconds)
+{
+	if ((range.type != AF_INET) && (range.type != AF_INET6))
+		return NULL;
+
+	BanCacheHash::iterator it = BanHash.find(range);
+	if ((it != BanHash.end()) && (!RemoveIfExpired(it))) // can't have two cache entries on the same IP, sorry..
 		return NULL;
 
-	b = new BanCacheHit(type, reason, (seconds ? seconds : 86400));
+	BanCacheHit* b = new BanCacheHit(type, reason, (seconds ? seconds : 86400));
+	b->Range = range;
+	b->Generation = GetGeneration(b);
+	BanHash[range] = b;
+	LRU.push_front(b);
+
+	const unsigned char fulllength = (range.type == AF_INET) ? 32 : 128;
+	if (range.length < fulllength)
+		Ranges[std::make_pair(range.type, range.length)]++;
+
+	while (BanHash.size() > ServerInstance->Config->BanCacheSize)
+	{
+		BanCacheHash::iterator oldest = BanHash.find(LRU.back()->Range);
+		RemoveHit(oldest);
+	}
 	return b;
 }
 
-BanCacheHit *BanCacheManager::GetHit(const std::string &ip)
+BanCacheHit *BanCacheManager::AddHit(const irc::sockets::sockaddrs& sa, const std::string &type, const std::string &reason, time_t seconds)
+{
+	return AddHit(irc::sockets::cidr_mask(sa, 128), type, reason, seconds);
+}
+
+BanCacheHit *BanCacheManager::GetHit(const irc::sockets::sockaddrs& sa)
 {
-	BanCacheHash::iterator i = this->BanHash.find(ip);
+	if ((sa.sa.sa_family != AF_INET) && (sa.sa.sa_family != AF_INET6))
+		return NULL;
+
+	BanCacheHash::iterator i = this->BanHash.find(irc::sockets::cidr_mask(sa, 128));
+	if ((i == this->BanHash.end()) || (RemoveIfExpired(i)))
+	{
+		/* Look for a hit for a range the address is in, starting from the longest prefix */
+		i = this->BanHash.end();
+		for (std::map<std::pair<unsigned char, unsigned char>, unsigned long>::reverse_iterator r = Ranges.rbegin(); r != Ranges.rend(); ++r)
+		{
+			if ((r->first.first != sa.sa.sa_family) || (!r->second))
+				continue;
+
+			i = this->BanHash.find(irc::sockets::cidr_mask(sa, r->first.second));
+			if ((i != this->BanHash.end()) && (!RemoveIfExpired(i)))
+				break;
+			i = this->BanHash.end();
+		}
 
-	if (i == this->BanHash.end())
-		return NULL; // free and safe
+		if (i == this->BanHash.end())
+			return NULL; // free and safe
+	}
+
+	BanCacheHit* b = i->second;
+	LRU.erase(b);
+	LRU.push_front(b);
+	return b; // hit.
+}
 
-	if (RemoveIfExpired(i))
-		return NULL; // expired
+void BanCacheManager::RemoveHit(BanCacheHash::iterator& it)
+{
+	BanCacheHit* b = it->second;
+	const unsigned char fulllength = (b->Range.type == AF_INET) ? 32 : 128;
+	if (b->Range.length < fulllength)
+	{
+		/* The counter is kept when it drops to zero as GetHit() may be iterating over Ranges */
+		Ranges[std::make_pair(b->Range.type, b->Range.length)]--;
+	}
 
-	return i->second; // hit.
+	LRU.erase(b);
+	delete b;
+	it = BanHash.erase(it);
 }
 
 bool BanCacheManager::RemoveIfExpired(BanCacheHash::iterator& it)
 {
-	if (ServerInstance->Time() < it->second->Expiry)
+	if ((ServerInstance->Time() < it->second->Expiry) && (it->second->Generation == GetGeneration(it->second)))
 		return false;
 
-	ServerInstance->Logs->Log("BANCACHE", LOG_DEBUG, "Hit on " + it->first + " is out of date, removing!");
-	delete it->second;
-	it = BanHash.erase(it);
+	ServerInstance->Logs->Log("BANCACHE", LOG_DEBUG, "Hit on " + it->second->Range.str() + " is out of date, removing!");
+	RemoveHit(it);
 	return true;
 }
 
 void BanCacheManager::RemoveEntries(const std::string& type, bool positive)
 {
+	/* The hits are not removed here, they are removed when they are looked up or evicted */
 	if (positive)
+	{
 		ServerInstance->Logs->Log("BANCACHE", LOG_DEBUG, "BanCacheManager::RemoveEntries(): Removing positive hits for " + type);
+		Generations[type]++;
+	}
 	else
-		ServerInstance->Logs->Log("BANCACHE", LOG_DEBUG, "BanCacheManager::RemoveEntries(): Removing all negative hits");
-
-	for (BanCacheHash::iterator i = BanHash.begin(); i != BanHash.end(); )
 	{
-		if (RemoveIfExpired(i))
-			continue; // updates the iterator if expired
-
-		BanCacheHit* b = i->second;
-		bool remove = false;
-
-		if (positive)
-		{
-			// when removing positive hits, remove only if the type matches
-			remove = b->IsPositive() && (b->Type == type);
-		}
-		else
-		{
-			// when removing negative hits, remove all of them
-			remove = !b->IsPositive();
-		}
-
-		if (remove)
-		{
-			/* we need to remove this one. */
-			ServerInstance->Logs->Log("BANCACHE", LOG_DEBUG, "BanCacheManager::RemoveEntries(): Removing a hit on " + i->first);
-			delete b;
-			i = BanHash.erase(i);
-		}
-		else
-			++i;
+		ServerInstance->Logs->Log("BANCACHE", LOG_DEBUG, "BanCacheManager::RemoveEntries(): Removing all negative hits");
+		NegativeGeneration++;
 	}
 }
 
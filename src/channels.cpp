@@ -37,8 +37,13 @@ namespace
 	UserModeReference invisiblemode(NULL, "invisible");
 }
 
+bool Channel::bancheckvolatile = false;
+
+/** Storage for the Memberships of all channels */
+static insp::object_pool<Membership> membershippool;
+
 Channel::Channel(const std::string &cname, time_t ts)
-	: name(cname), age(ts), topicset(0)
+	: name(cname), age(ts), topicset(0), bangeneration(1)
 {
 	if (!ServerInstance->chanlist.insert(std::make_pair(cname, this)).second)
 		throw CoreException("Cannot create duplicate channel " + cname);
@@ -61,11 +66,17 @@ void Channel::SetTopic(User* u, const std::string& ntopic)
 
 Membership* Channel::AddUser(User* user)
 {
-	std::pair<MemberMap::iterator, bool> ret = userlist.insert(std::make_pair(user, insp::aligned_storage<Membership>()));
+	std::pair<MemberMap::iterator, bool> ret = userlist.insert(std::make_pair(user, static_cast<Membership*>(NULL)));
 	if (!ret.second)
 		return NULL;
 
-	Membership* memb = new(ret.first->second) Membership(user, this);
+	Membership* memb = new(membershippool.allocate()) Membership(user, this);
+	ret.first->second = memb;
+	if (IS_LOCAL(user))
+	{
+		memb->localpos = localusers.size();
+		localusers.push_back(memb);
+	}
 	return memb;
 }
 
@@ -101,8 +112,17 @@ void Channel::CheckDestroy()
 void Channel::DelUser(const MemberMap::iterator& membiter)
 {
 	Membership* memb = membiter->second;
+	if (IS_LOCAL(memb->user))
+	{
+		// Move the last local member into the place of the removed one
+		Membership* last = localusers.back();
+		last->localpos = memb->localpos;
+		localusers[memb->localpos] = last;
+		localusers.pop_back();
+	}
 	memb->cull();
 	memb->~Membership();
+	membershippool.deallocate(memb);
 	userlist.erase(membiter);
 
 	// If this channel became empty then it should be removed
@@ -367,19 +387,37 @@ bool Channel::IsBanned(User* user)
 	if (result != MOD_RES_PASSTHRU)
 		return (result == MOD_RES_DENY);
 
+	// Only check the bans which the index of the list finds for the user
 	ListModeBase* banlm = static_cast<ListModeBase*>(*ban);
-	const ListModeBase::ModeList* bans = banlm->GetList(this);
-	if (bans)
+	std::vector<const ListModeBase::ListItem*> bans;
+	banlm->FindItems(this, user, bans);
+	for (std::vector<const ListModeBase::ListItem*>::const_iterator it = bans.begin(); it != bans.end(); ++it)
 	{
-		for (ListModeBase::ModeList::const_iterator it = bans->begin(); it != bans->end(); it++)
-		{
-			if (CheckBan(user, it->mask))
-				return true;
-		}
+		if (CheckBan(user, (*it)->matcher, (*it)->cidr))
+			return true;
 	}
 	return false;
 }
 
+bool Membership::IsBanned()
+{
+	if ((bangeneration == chan->bangeneration) && (identitygeneration == user->identitygeneration))
+		return banned;
+
+	// A ban check may run inside another one, e.g. through an extban, so a volatile inner check
+	// must also make the outer one volatile
+	const bool outervolatile = Channel::bancheckvolatile;
+	Channel::bancheckvolatile = false;
+	banned = chan->IsBanned(user);
+	if ((!Channel::bancheckvolatile) && (ServerInstance->Modules->AreBanChecksCacheable()))
+	{
+		bangeneration = chan->bangeneration;
+		identitygeneration = user->identitygeneration;
+	}
+	Channel::bancheckvolatile |= outervolatile;
+	return banned;
+}
+
 bool Channel::CheckBan(User* user, const std::string& mask)
 {
 	ModResult result;
@@ -395,6 +433,7 @@ bool Channel::CheckBan(User* user, const std::string& mask)
 	if (at == std::string::npos)
 		return false;
 
+	// The mask is only used once, so match it directly instead of compiling it
 	const std::string nickIdent = user->nick + "!" + user->ident;
 	std::string prefix = mask.substr(0, at);
 	if (InspIRCd::Match(nickIdent, prefix, NULL))
@@ -408,6 +447,49 @@ bool Channel::CheckBan(User* user, const std::string& mask)
 	return false;
 }
 
+bool Channel::CheckBan(User* user, const WildcardMask& matcher, const irc::sockets::cidr_mask& cidr)
+{
+	const std::string& mask = matcher.str();
+	ModResult result;
+	FIRST_MOD_RESULT(OnCheckBan, result, (user, this, mask));
+	if (result != MOD_RES_PASSTHRU)
+		return (result == MOD_RES_DENY);
+
+	// extbans were handled above, if this is one it obviously didn't match
+	if ((mask.length() <= 2) || (mask[1] == ':'))
+		return false;
+
+	std::string::size_type at = mask.find('@');
+	if (at == std::string::npos)
+		return false;
+
+	/* Matching the whole mask against nick!ident@host gives the same result as matching the part
+	 * before the '@' against nick!ident and the part after it against the host, as none of
+	 * them can contain an '@'. The buffer is reused to avoid allocating for every ban.
+	 */
+	static std::string subject;
+	subject.assign(user->nick).push_back('!');
+	subject.append(user->ident).push_back('@');
+	const std::string::size_type hostpos = subject.length();
+
+	subject.append(user->host);
+	if (matcher.Match(subject))
+		return true;
+
+	if (user->dhost != user->host)
+	{
+		subject.erase(hostpos).append(user->dhost);
+		if (matcher.Match(subject))
+			return true;
+	}
+
+	subject.erase(hostpos).append(user->GetIPString());
+	if (matcher.Match(subject))
+		return true;
+
+	return ((cidr.match(user->client_sa)) && (InspIRCd::Match(subject.substr(0, hostpos - 1), mask.substr(0, at), NULL)));
+}
+
 ModResult Channel::GetExtBanStatus(User *user, char type)
 {
 	ModResult rv;
@@ -416,14 +498,12 @@ ModResult Channel::GetExtBanStatus(User *user, char type)
 		return rv;
 
 	ListModeBase* banlm = static_cast<ListModeBase*>(*ban);
-	const ListModeBase::ModeList* bans = banlm->GetList(this);
-	if (bans)
+	std::vector<const ListModeBase::ListItem*> bans;
+	banlm->FindExtBans(this, type, bans);
+	for (std::vector<const ListModeBase::ListItem*>::const_iterator it = bans.begin(); it != bans.end(); ++it)
 	{
-		for (ListModeBase::ModeList::const_iterator it = bans->begin(); it != bans->end(); ++it)
-		{
-			if (CheckBan(user, it->mask))
-				return MOD_RES_DENY;
-		}
+		if (CheckBan(user, (*it)->mask.substr(2)))
+			return MOD_RES_DENY;
 	}
 	return MOD_RES_PASSTHRU;
 }
@@ -473,13 +553,12 @@ void Channel::WriteChannel(User* user, const char* text, ...)
 
 void Channel::WriteChannel(User* user, const std::string &text)
 {
-	const std::string message = ":" + user->GetFullHost() + " " + text;
+	LineBuilder line(user->GetFullHost());
+	line.Append(text);
+	const reference<SendBuffer>& message = line.Finish();
 
-	for (MemberMap::iterator i = userlist.begin(); i != userlist.end(); i++)
-	{
-		if (IS_LOCAL(i->first))
-			i->first->Write(message);
-	}
+	for (LocalMemberList::const_iterator i = localusers.begin(); i != localusers.end(); ++i)
+		static_cast<LocalUser*>((*i)->user)->Write(message);
 }
 
 void Channel::WriteChannelWithServ(const std::string& ServName, const char* text, ...)
@@ -491,13 +570,12 @@ void Channel::WriteChannelWithServ(const std::string& ServName, const char* text
 
 void Channel::WriteChannelWithServ(const std::string& ServName, const std::string &text)
 {
-	const std::string message = ":" + (ServName.empty() ? ServerInstance->Config->ServerName : ServName) + " " + text;
+	LineBuilder line(ServName.empty() ? ServerInstance->Config->ServerName : ServName);
+	line.Append(text);
+	const reference<SendBuffer>& message = line.Finish();
 
-	for (MemberMap::iterator i = userlist.begin(); i != userlist.end(); i++)
-	{
-		if (IS_LOCAL(i->first))
-			i->first->Write(message);
-	}
+	for (LocalMemberList::const_iterator i = localusers.begin(); i != localusers.end(); ++i)
+		static_cast<LocalUser*>((*i)->user)->Write(message);
 }
 
 /* write formatted text from a source user to all users on a channel except
@@ -513,17 +591,22 @@ void Channel::WriteAllExcept(User* user, bool serversource, char status, CUList
 {
 	std::string textbuffer;
 	VAFORMAT(textbuffer, text, text);
-	textbuffer = ":" + (serversource ? ServerInstance->Config->ServerName : user->GetFullHost()) + " " + textbuffer;
-	this->RawWriteAllExcept(user, serversource, status, except_list, textbuffer);
+	this->WriteAllExcept(user, serversource, status, except_list, textbuffer);
 }
 
 void Channel::WriteAllExcept(User* user, bool serversource, char status, CUList &except_list, const std::string &text)
 {
-	const std::string message = ":" + (serversource ? ServerInstance->Config->ServerName : user->GetFullHost()) + " " + text;
-	this->RawWriteAllExcept(user, serversource, status, except_list, message);
+	LineBuilder line(serversource ? ServerInstance->Config->ServerName : user->GetFullHost());
+	line.Append(text);
+	this->RawWriteAllExcept(user, serversource, status, except_list, line.Finish());
 }
 
 void Channel::RawWriteAllExcept(User* user, bool serversource, char status, CUList &except_list, const std::string &out)
+{
+	this->RawWriteAllExcept(user, serversource, status, except_list, LocalUser::MakeLine(out));
+}
+
+void Channel::RawWriteAllExcept(User* user, bool serversource, char status, CUList &except_list, const reference<SendBuffer>& line)
 {
 	unsigned int minrank = 0;
 	if (status)
@@ -532,15 +615,18 @@ void Channel::RawWriteAllExcept(User* user, bool serversource, char status, CULi
 		if (mh)
 			minrank = mh->GetPrefixRank();
 	}
-	for (MemberMap::iterator i = userlist.begin(); i != userlist.end(); i++)
+
+	for (LocalMemberList::const_iterator i = localusers.begin(); i != localusers.end(); ++i)
 	{
-		if (IS_LOCAL(i->first) && (except_list.find(i->first) == except_list.end()))
+		Membership* memb = *i;
+		LocalUser* lu = static_cast<LocalUser*>(memb->user);
+		if (except_list.find(lu) == except_list.end())
 		{
 			/* User doesn't have the status we're after */
-			if (minrank && i->second->getRank() < minrank)
+			if (minrank && memb->getRank() < minrank)
 				continue;
 
-			i->first->Write(out);
+			lu->Write(line);
 		}
 	}
 }
@@ -21,15 +21,100 @@
 
 #include "inspircd.h"
 
+/** Convert a numeric IPv4 or IPv6 address which is not null terminated to a binary sockaddr
+ * @param addr The address
+ * @param len Length of addr
+ * @param sa Filled with the address; only the family and the address are set
+ * @return True if the address was valid
+ */
+static bool ParseAddress(const char* addr, std::string::size_type len, irc::sockets::sockaddrs& sa)
+{
+	char buf[INET6_ADDRSTRLEN + 1];
+	if (len >= sizeof(buf))
+		return false;
+
+	memcpy(buf, addr, len);
+	buf[len] = 0;
+	if (inet_pton(AF_INET, buf, &sa.in4.sin_addr) > 0)
+	{
+		sa.sa.sa_family = AF_INET;
+		return true;
+	}
+	if (inet_pton(AF_INET6, buf, &sa.in6.sin6_addr) > 0)
+	{
+		sa.sa.sa_family = AF_INET6;
+		return true;
+	}
+	return false;
+}
+
+/** Parse a CIDR mask which is not null terminated, without copying it
+ * @param mask The mask, e.g. 1.2.0.0/16
+ * @param len Length of mask
+ * @param cidr Filled with the parsed mask if it is valid
+ * @return True if the mask is a valid CIDR mask of an IPv4 or IPv6 address
+ */
+static bool ParseMask(const char* mask, std::string::size_type len, irc::sockets::cidr_mask& cidr)
+{
+	std::string::size_type per_pos = len;
+	while ((per_pos) && (mask[per_pos - 1] != '/'))
+		per_pos--;
+
+	if ((!per_pos) || (per_pos == len))
+		return false;
+	per_pos--;
+
+	int range = 0;
+	for (std::string::size_type i = per_pos + 1; i < len; i++)
+	{
+		if ((mask[i] < '0') || (mask[i] > '9'))
+			return false;
+		// Anything above 128 is treated as 128 when the mask is built
+		if (range <= 128)
+			range = (range * 10) + (mask[i] - '0');
+	}
+
+	for (std::string::size_type i = 0; i < per_pos; i++)
+	{
+		if ((!isxdigit((unsigned char)mask[i])) && (mask[i] != '.') && (mask[i] != ':'))
+			return false;
+	}
+
+	irc::sockets::sockaddrs sa;
+	if (!ParseAddress(mask, per_pos, sa))
+		return false;
+
+	cidr = irc::sockets::cidr_mask(sa, range);
+	return true;
+}
+
+/** Check if an address which is not null terminated is within a CIDR mask which is not null terminated
+ */
+static bool MatchAddress(const char* address, std::string::size_type addrlen, const char* mask, std::string::size_type masklen)
+{
+	irc::sockets::cidr_mask cidr;
+	irc::sockets::sockaddrs sa;
+	return ((ParseMask(mask, masklen, cidr)) && (ParseAddress(address, addrlen, sa)) && (cidr.match(sa)));
+}
+
+bool irc::sockets::ParseCIDR(const std::string& mask, cidr_mask& cidr)
+{
+	return ParseMask(mask.data(), mask.length(), cidr);
+}
+
 /* Match CIDR strings, e.g. 127.0.0.1 to 127.0.0.0/8 or 3ffe:1:5:6::8 to 3ffe:1::0/32
  *
  * This will also attempt to match any leading usernames or nicknames on the mask, using
  * match(), when match_with_username is true.
+ *
+ * Neither the address nor the mask are copied unless both have a username to match, so
+ * callers matching many addresses should still prefer parsing the mask once with ParseCIDR()
+ * and calling cidr_mask::match() on the binary address.
  */
 bool irc::sockets::MatchCIDR(const std::string &address, const std::string &cidr_mask, bool match_with_username)
 {
-	std::string address_copy;
-	std::string cidr_copy;
+	std::string::size_type address_start = 0;
+	std::string::size_type mask_start = 0;
 
 	/* The caller is trying to match ident@<mask>/bits.
 	 * Chop off the ident@ portion, use match() on it
@@ -37,46 +122,25 @@ bool irc::sockets::MatchCIDR(const std::string &address, const std::string &cidr
 	 */
 	if (match_with_username)
 	{
-		/* Use strchr not strrchr, because its going to be nearer to the left */
 		std::string::size_type username_mask_pos = cidr_mask.rfind('@');
 		std::string::size_type username_addr_pos = address.rfind('@');
 
 		/* Both strings have an @ symbol in them */
 		if (username_mask_pos != std::string::npos && username_addr_pos != std::string::npos)
 		{
-			/* Try and match() the strings before the @
-			 * symbols, and recursively call MatchCIDR without
-			 * username matching enabled to match the host part.
+			/* Match the host parts first as that does not need any copies,
+			 * then match() the strings before the @ symbols.
 			 */
-			return (InspIRCd::Match(address.substr(0, username_addr_pos), cidr_mask.substr(0, username_mask_pos), ascii_case_insensitive_map) &&
-					MatchCIDR(address.substr(username_addr_pos + 1), cidr_mask.substr(username_mask_pos + 1), false));
-		}
-		else
-		{
-			address_copy = address.substr(username_addr_pos + 1);
-			cidr_copy = cidr_mask.substr(username_mask_pos + 1);
+			return (MatchAddress(address.data() + username_addr_pos + 1, address.length() - username_addr_pos - 1,
+					cidr_mask.data() + username_mask_pos + 1, cidr_mask.length() - username_mask_pos - 1) &&
+				InspIRCd::Match(address.substr(0, username_addr_pos), cidr_mask.substr(0, username_mask_pos), ascii_case_insensitive_map));
 		}
-	}
-	else
-	{
-		address_copy.assign(address);
-		cidr_copy.assign(cidr_mask);
-	}
 
-	const std::string::size_type per_pos = cidr_copy.rfind('/');
-	if ((per_pos == std::string::npos) || (per_pos == cidr_copy.length()-1)
-		|| (cidr_copy.find_first_not_of("0123456789", per_pos+1) != std::string::npos)
-		|| (cidr_copy.find_first_not_of("0123456789abcdefABCDEF.:") < per_pos))
-	{
-		// The CIDR mask is invalid
-		return false;
+		/* Skip the part before the @ symbol of the one which has it, if any */
+		address_start = username_addr_pos + 1;
+		mask_start = username_mask_pos + 1;
 	}
 
-	irc::sockets::sockaddrs addr;
-	irc::sockets::aptosa(address_copy, 0, addr);
-
-	irc::sockets::cidr_mask mask(cidr_copy);
-	irc::sockets::cidr_mask mask2(addr, mask.length);
-
-	return mask == mask2;
+	return MatchAddress(address.data() + address_start, address.length() - address_start,
+		cidr_mask.data() + mask_start, cidr_mask.length() - mask_start);
 }
@@ -107,8 +107,58 @@ bool CommandParser::LoopCall(User* user, Command* handler, const std::vector<std
 	return true;
 }
 
-Command* CommandParser::GetHandler(const std::string &commandname)
+namespace
 {
+	/** Hash a command name, ignoring the case of ASCII letters
+	 * @param name The name to hash
+	 * @param length The length of the name
+	 * @param seed Seed which selects one of many independent hash functions
+	 * @return The hash value
+	 */
+	unsigned int HashCommandName(const char* name, size_t length, unsigned int seed)
+	{
+		unsigned int hash = 2166136261U ^ (seed * 0x9E3779B9U);
+		for (size_t i = 0; i < length; i++)
+		{
+			hash ^= static_cast<unsigned char>(name[i]) & ~0x20;
+			hash *= 16777619U;
+		}
+		hash ^= hash >> 15;
+		hash *= 0x2C1B3C6DU;
+		hash ^= hash >> 12;
+		return hash;
+	}
+
+	bool CommandNameEquals(const std::string& cmdname, const char* name, size_t length)
+	{
+		if (cmdname.length() != length)
+			return false;
+
+		for (size_t i = 0; i < length; i++)
+		{
+			if (cmdname[i] != static_cast<char>(toupper(static_cast<unsigned char>(name[i]))))
+				return false;
+		}
+		return true;
+	}
+}
+
+Command* CommandParser::FindCommand(const char* name, size_t length)
+{
+	if (!cmdslots.empty())
+	{
+		const unsigned int seed = cmdseeds[HashCommandName(name, length, 0) & (cmdseeds.size() - 1)];
+		Command* cmd = cmdslots[HashCommandName(name, length, seed) & (cmdslots.size() - 1)];
+		if ((cmd) && (CommandNameEquals(cmd->name, name, length)))
+			return cmd;
+
+		// Commands added since the table was built are only in the map
+		if (!unindexedcmds)
+			return NULL;
+	}
+
+	std::string commandname(name, length);
+	std::transform(commandname.begin(), commandname.end(), commandname.begin(), ::toupper);
 	CommandMap::iterator n = cmdlist.find(commandname);
 	if (n != cmdlist.end())
 		return n->second;
@@ -116,26 +166,98 @@ Command* CommandParser::GetHandler(const std::string &commandname)
 	return NULL;
 }
 
+void CommandParser::BuildCommandTable()
+{
+	cmdseeds.clear();
+	cmdslots.clear();
+	unindexedcmds = 0;
+
+	if (cmdlist.empty())
+		return;
+
+	// Keep the buckets small and at least half of the slots empty, that way a seed is found after a few tries
+	size_t bucketcount = 1;
+	while (bucketcount * 2 < cmdlist.size())
+		bucketcount *= 2;
+	size_t slotcount = 1;
+	while (slotcount < cmdlist.size() * 2)
+		slotcount *= 2;
+
+	std::vector<std::vector<Command*> > buckets(bucketcount);
+	for (CommandMap::const_iterator i = cmdlist.begin(); i != cmdlist.end(); ++i)
+	{
+		const std::string& cmdname = i->first;
+		buckets[HashCommandName(cmdname.data(), cmdname.length(), 0) & (bucketcount - 1)].push_back(i->second);
+	}
+
+	// Place the largest buckets first, while most slots are still free
+	std::vector<std::pair<size_t, size_t> > order;
+	for (size_t i = 0; i < bucketcount; i++)
+	{
+		if (!buckets[i].empty())
+			order.push_back(std::make_pair(buckets[i].size(), i));
+	}
+	std::sort(order.begin(), order.end(), std::greater<std::pair<size_t, size_t> >());
+
+	std::vector<unsigned int> seeds(bucketcount);
+	std::vector<Command*> slots(slotcount);
+	std::vector<size_t> positions;
+	for (std::vector<std::pair<size_t, size_t> >::const_iterator i = order.begin(); i != order.end(); ++i)
+	{
+		const std::vector<Command*>& bucket = buckets[i->second];
+		for (unsigned int seed = 1; ; seed++)
+		{
+			// Fall back to the map for all commands rather than searching forever
+			if (seed > 100000)
+			{
+				ServerInstance->Logs->Log("COMMAND", LOG_DEBUG, "Unable to build the command hash table for %u commands", (unsigned int)cmdlist.size());
+				return;
+			}
+
+			positions.clear();
+			for (std::vector<Command*>::const_iterator j = bucket.begin(); j != bucket.end(); ++j)
+			{
+				const std::string& cmdname = (*j)->name;
+				const size_t pos = HashCommandName(cmdname.data(), cmdname.length(), seed) & (slotcount - 1);
+				if ((slots[pos]) || (stdalgo::isin(positions, pos)))
+					break;
+				positions.push_back(pos);
+			}
+
+			if (positions.size() == bucket.size())
+			{
+				for (size_t j = 0; j < bucket.size(); j++)
+					slots[positions[j]] = bucket[j];
+				seeds[i->second] = seed;
+				break;
+			}
+		}
+	}
+
+	cmdseeds.swap(seeds);
+	cmdslots.swap(slots);
+}
+
 // calls a handler function for a command
 
 CmdResult CommandParser::CallHandler(const std::string& commandname, const std::vector<std::string>& parameters, User* user, Command** cmd)
 {
-	CommandMap::iterator n = cmdlist.find(commandname);
+	Command* handler = GetHandler(commandname);
 
-	if (n != cmdlist.end())
+	if (handler)
 	{
-		if ((!parameters.empty()) && (parameters.back().empty()) && (!n->second->allow_empty_last_param))
+		if ((!parameters.empty()) && (parameters.back().empty()) && (!handler->allow_empty_last_param))
 			return CMD_INVALID;
 
-		if (parameters.size() >= n->second->min_params)
+		if (parameters.size() >= handler->min_params)
 		{
 			bool bOkay = false;
 
-			if (IS_LOCAL(user) && n->second->flags_needed)
+			if (IS_LOCAL(user) && handler->flags_needed)
 			{
 				/* if user is local, and flags are needed .. */
 
-				if (user->IsModeSet(n->second->flags_needed))
+				if (user->IsModeSet(handler->flags_needed))
 				{
 					/* if user has the flags, and now has the permissions, go ahead */
 					if (user->HasPermission(commandname))
@@ -151,36 +273,52 @@ CmdResult CommandParser::CallHandler(const std::string& commandname, const std::
 			if (bOkay)
 			{
 				if (cmd)
-					*cmd = n->second;
-				return n->second->Handle(parameters,user);
+					*cmd = handler;
+				return handler->Handle(parameters,user);
 			}
 		}
 	}
 	return CMD_INVALID;
 }
 
-void CommandParser::ProcessCommand(LocalUser *user, std::string &cmd)
+void CommandParser::ProcessCommand(LocalUser *user, std::string &cmd, std::vector<std::string>& command_p)
 {
-	std::vector<std::string> command_p;
-	irc::tokenstream tokens(cmd);
-	std::string command, token;
-	tokens.GetToken(command);
+	irc::tokenlist tokens;
+	irc::tokenize(cmd, tokens);
 
 	/* A client sent a nick prefix on their command (ick)
 	 * rhapsody and some braindead bouncers do this --
 	 * the rfc says they shouldnt but also says the ircd should
 	 * discard it if they do.
 	 */
-	if (command[0] == ':')
-		tokens.GetToken(command);
+	size_t first = 0;
+	if ((!tokens.empty()) && (tokens[0].data[0] == ':'))
+		first = 1;
 
-	while (tokens.GetToken(token))
-		command_p.push_back(token);
-
-	std::transform(command.begin(), command.end(), command.begin(), ::toupper);
+	const irc::tokenview cmdtoken = (first < tokens.size() ? tokens[first] : irc::tokenview());
 
 	/* find the command, check it exists */
-	Command* handler = GetHandler(command);
+	Command* handler = FindCommand(cmdtoken.data, cmdtoken.length);
+
+	std::string command;
+	if (handler)
+	{
+		command = handler->name;
+	}
+	else
+	{
+		command.assign(cmdtoken.data, cmdtoken.length);
+		std::transform(command.begin(), command.end(), command.begin(), ::toupper);
+	}
+
+	/* Copy the parameters into the strings left over from previous commands */
+	const size_t paramcount = (first < tokens.size() ? tokens.size() - first - 1 : 0);
+	command_p.resize(paramcount);
+	for (size_t i = 0; i < paramcount; i++)
+	{
+		const irc::tokenview& token = tokens[first + 1 + i];
+		command_p[i].assign(token.data, token.length);
+	}
 
 	/* Modify the user's penalty regardless of whether or not the command exists */
 	if (!user->HasPrivPermission("users/flood/no-throttle"))
@@ -250,7 +388,7 @@ void CommandParser::ProcessCommand(LocalUser *user, std::string &cmd)
 	if (MOD_RESULT == MOD_RES_DENY)
 		return;
 
-	/* activity resets the ping pending timer */
+	/* activity resets the ping pending timer, the user's UserTimeoutTimer picks this up when it ticks */
 	user->nping = ServerInstance->Time() + user->MyClass->GetPingTime();
 
 	if (handler->flags_needed)
@@ -324,7 +462,13 @@ void CommandParser::RemoveCommand(Command* x)
 {
 	CommandMap::iterator n = cmdlist.find(x->name);
 	if (n != cmdlist.end() && n->second == x)
+	{
 		cmdlist.erase(n);
+
+		std::vector<Command*>::iterator slot = std::find(cmdslots.begin(), cmdslots.end(), x);
+		if (slot != cmdslots.end())
+			*slot = NULL;
+	}
 }
 
 CommandBase::~CommandBase()
@@ -343,7 +487,12 @@ void CommandParser::ProcessBuffer(std::string &buffer,LocalUser *user)
 
 	ServerInstance->Logs->Log("USERINPUT", LOG_RAWIO, "C[%s] I :%s %s",
 		user->uuid.c_str(), user->nick.c_str(), buffer.c_str());
-	ProcessCommand(user,buffer);
+
+	// Take the spare parameter vector so a nested call (e.g. a handler processing a line for another user) gets its own
+	std::vector<std::string> command_p;
+	command_p.swap(spareparams);
+	ProcessCommand(user, buffer, command_p);
+	command_p.swap(spareparams);
 }
 
 bool CommandParser::AddCommand(Command *f)
@@ -352,12 +501,15 @@ bool CommandParser::AddCommand(Command *f)
 	if (cmdlist.find(f->name) == cmdlist.end())
 	{
 		cmdlist[f->name] = f;
+		if (!cmdslots.empty())
+			unindexedcmds++;
 		return true;
 	}
 	return false;
 }
 
 CommandParser::CommandParser()
+	: unindexedcmds(0)
 {
 }
 
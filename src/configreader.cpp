@@ -60,6 +60,10 @@ ServerConfig::ServerConfig()
 	MaxTargets = 20;
 	NetBufferSize = 10240;
 	MaxConn = SOMAXCONN;
+	IOThreads = 0;
+	AcceptBatch = 16;
+	TCPCork = false;
+	BanCacheSize = 100000;
 	MaxChans = 20;
 	OperMaxChans = 30;
 	c_ipv4_range = 32;
@@ -395,10 +399,14 @@ void ServerConfig::Fill()
 	SoftLimit = ConfValue("performance")->getInt("softlimit", (SocketEngine::GetMaxFds() > 0 ? SocketEngine::GetMaxFds() : LONG_MAX), 10);
 	CCOnConnect = ConfValue("performance")->getBool("clonesonconnect", true);
 	MaxConn = ConfValue("performance")->getInt("somaxconn", SOMAXCONN);
+	AcceptBatch = ConfValue("performance")->getInt("acceptbatch", 16, 1, 1024);
+	TCPCork = ConfValue("performance")->getBool("tcpcork");
+	BanCacheSize = ConfValue("performance")->getInt("bancachesize", 100000, 100);
 	XLineMessage = options->getString("xlinemessage", options->getString("moronbanner", "You're banned!"));
 	ServerDesc = ConfValue("server")->getString("description", "Configure Me");
 	Network = ConfValue("server")->getString("network", "Network");
 	NetBufferSize = ConfValue("performance")->getInt("netbuffersize", 10240, 1024, 65534);
+	IOThreads = ConfValue("performance")->getInt("iothreads", 0, 0, 64);
 	dns_timeout = ConfValue("dns")->getInt("timeout", 5);
 	DisabledCommands = ConfValue("disabled")->getString("commands", "");
 	DisabledDontExist = ConfValue("disabled")->getBool("fakenonexistant");
@@ -719,6 +727,9 @@ void ServerConfig::ApplyModules(User* user)
 				ServerInstance->SNO->WriteGlobalSno('a', "Failed to load module %s: %s", adding->c_str(), ServerInstance->Modules->LastError().c_str());
 		}
 	}
+
+	// Index the commands of the modules loaded since startup or the last rehash
+	ServerInstance->Parser.BuildCommandTable();
 }
 
 ConfigTag* ServerConfig::ConfValue(const std::string &tag)
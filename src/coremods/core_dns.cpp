@@ -142,9 +142,15 @@ class Packet : public Query
 		record.ttl = (input[pos] << 24) | (input[pos + 1] << 16) | (input[pos + 2] << 8) | input[pos + 3];
 		pos += 4;
 
-		//record.rdlength = input[pos] << 8 | input[pos + 1];
+		const unsigned short rdlength = input[pos] << 8 | input[pos + 1];
 		pos += 2;
 
+		if (pos + rdlength > input_size)
+			throw Exception("Unable to unpack resource record");
+
+		/* Records of types we don't know about are skipped */
+		const unsigned short rdend = pos + rdlength;
+
 		switch (record.type)
 		{
 			case QUERY_A:
@@ -185,9 +191,23 @@ class Packet : public Query
 				record.rdata = this->UnpackName(input, input_size, pos);
 				break;
 			}
+			case QUERY_SOA:
+			{
+				/* The TTL of a negative answer is the smaller of the TTL of the SOA record and its minimum field (RFC 2308) */
+				record.rdata = this->UnpackName(input, input_size, pos);
+				this->UnpackName(input, input_size, pos);
+
+				if (pos + 20 > input_size)
+					throw Exception("Unable to unpack resource record");
+
+				const unsigned int minimum = (input[pos + 16] << 24) | (input[pos + 17] << 16) | (input[pos + 18] << 8) | input[pos + 19];
+				record.ttl = std::min(record.ttl, minimum);
+				break;
+			}
 			default:
 				break;
 		}
+		pos = rdend;
 
 		if (!record.name.empty() && !record.rdata.empty())
 			ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, record.name + " -> " + record.rdata);
@@ -204,11 +224,44 @@ class Packet : public Query
 	unsigned short id;
 	/* Flags on the packet */
 	unsigned short flags;
+	/* How long a negative answer may be cached for, from the SOA record in the authority section, or -1 if there was none */
+	long negativettl;
 
-	Packet() : id(0), flags(0)
+	Packet() : id(0), flags(0), negativettl(-1)
 	{
 	}
 
+	/** Get the name which is looked up for a PTR query
+	 * @param ip The IP address the query is for
+	 * @return The name of the IP address in the in-addr.arpa or ip6.arpa domain
+	 */
+	static std::string GetPTRName(const std::string& ip)
+	{
+		irc::sockets::sockaddrs addr;
+		irc::sockets::aptosa(ip, 0, addr);
+
+		if (ip.find(':') != std::string::npos)
+		{
+			static const char* const hex = "0123456789abcdef";
+			char reverse_ip[128];
+			unsigned reverse_ip_count = 0;
+			for (int j = 15; j >= 0; --j)
+			{
+				reverse_ip[reverse_ip_count++] = hex[addr.in6.sin6_addr.s6_addr[j] & 0xF];
+				reverse_ip[reverse_ip_count++] = '.';
+				reverse_ip[reverse_ip_count++] = hex[addr.in6.sin6_addr.s6_addr[j] >> 4];
+				reverse_ip[reverse_ip_count++] = '.';
+			}
+			reverse_ip[reverse_ip_count++] = 0;
+
+			return std::string(reverse_ip) + "ip6.arpa";
+		}
+
+		unsigned long forward = addr.in4.sin_addr.s_addr;
+		addr.in4.sin_addr.s_addr = forward << 24 | (forward & 0xFF00) << 8 | (forward & 0xFF0000) >> 8 | forward >> 24;
+		return addr.addr() + ".in-addr.arpa";
+	}
+
 	void Fill(const unsigned char* input, const unsigned short len)
 	{
 		if (len < HEADER_LENGTH)
@@ -244,6 +297,21 @@ class Packet : public Query
 
 		for (unsigned i = 0; i < ancount; ++i)
 			this->answers.push_back(this->UnpackResourceRecord(input, len, packet_pos));
+
+		/* The authority section is only used for the TTL of negative answers, the answer is still usable without it */
+		try
+		{
+			for (unsigned i = 0; i < nscount; ++i)
+			{
+				const ResourceRecord rr = this->UnpackResourceRecord(input, len, packet_pos);
+				if (rr.type == QUERY_SOA)
+					this->negativettl = rr.ttl;
+			}
+		}
+		catch (Exception& ex)
+		{
+			ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Ignoring authority section: " + ex.GetReason());
+		}
 	}
 
 	unsigned short Pack(unsigned char* output, unsigned short output_size)
@@ -271,35 +339,7 @@ class Packet : public Query
 			Question& q = this->questions[i];
 
 			if (q.type == QUERY_PTR)
-			{
-				irc::sockets::sockaddrs ip;
-				irc::sockets::aptosa(q.name, 0, ip);
-
-				if (q.name.find(':') != std::string::npos)
-				{
-					static const char* const hex = "0123456789abcdef";
-					char reverse_ip[128];
-					unsigned reverse_ip_count = 0;
-					for (int j = 15; j >= 0; --j)
-					{
-						reverse_ip[reverse_ip_count++] = hex[ip.in6.sin6_addr.s6_addr[j] & 0xF];
-						reverse_ip[reverse_ip_count++] = '.';
-						reverse_ip[reverse_ip_count++] = hex[ip.in6.sin6_addr.s6_addr[j] >> 4];
-						reverse_ip[reverse_ip_count++] = '.';
-					}
-					reverse_ip[reverse_ip_count++] = 0;
-
-					q.name = reverse_ip;
-					q.name += "ip6.arpa";
-				}
-				else
-				{
-					unsigned long forward = ip.in4.sin_addr.s_addr;
-					ip.in4.sin_addr.s_addr = forward << 24 | (forward & 0xFF00) << 8 | (forward & 0xFF0000) >> 8 | forward >> 24;
-
-					q.name = ip.addr() + ".in-addr.arpa";
-				}
-			}
+				q.name = GetPTRName(q.name);
 
 			this->PackName(output, output_size, pos, q.name);
 
@@ -394,17 +434,219 @@ class Packet : public Query
 	}
 };
 
+class MyManager;
+
+/** Sends queries which have not been answered in time to a second nameserver
+ */
+class RaceTimer : public Timer
+{
+	MyManager* const manager;
+
+ public:
+	RaceTimer(MyManager* mgr) : Timer(1), manager(mgr) { }
+	bool Tick(time_t now);
+};
+
+/** A nameserver which queries are sent to
+ */
+struct NameServer
+{
+	/** A query which was sent to this server and may have to be sent to another server */
+	struct RaceEntry
+	{
+		/** The time at which the query should be sent to another server */
+		uint64_t deadline;
+		/** The time the query was sent, to tell it apart from later queries with the same id */
+		uint64_t sent;
+		unsigned short id;
+	};
+
+	irc::sockets::sockaddrs addr;
+
+	/** True if srtt and rttvar hold a measurement */
+	bool measured;
+
+	/** True if srtt has been raised because a query timed out, the next measurement replaces it */
+	bool backoff;
+
+	/** Smoothed round trip time of this server, and its variation, in milliseconds */
+	unsigned long srtt;
+	unsigned long rttvar;
+
+	/** Number of queries sent to this server, including races */
+	unsigned long queries;
+
+	/** Number of replies received from this server */
+	unsigned long replies;
+
+	/** Number of queries sent to this server because another server was slow to answer */
+	unsigned long races;
+
+	/** Number of queries sent to this server which were never answered */
+	unsigned long timeouts;
+
+	/** Queries sent to this server in the order of their race deadline */
+	std::deque<RaceEntry> racequeue;
+
+	NameServer(const irc::sockets::sockaddrs& sa)
+		: addr(sa), measured(false), backoff(false), srtt(0), rttvar(0), queries(0), replies(0), races(0), timeouts(0)
+	{
+	}
+
+	/** Get the number of milliseconds to wait for an answer before asking another server
+	 * @return The retransmission timeout of this server, based on its round trip times
+	 */
+	unsigned long GetRaceDelay() const
+	{
+		if (!measured)
+			return 500;
+
+		const unsigned long maxdelay = std::max(ServerInstance->Config->dns_timeout, 1) * 500UL;
+		return std::min(std::max(srtt + 4 * rttvar, 20UL), maxdelay);
+	}
+
+	/** Add a round trip time measurement
+	 * @param rtt Milliseconds between sending a query and receiving its reply
+	 */
+	void AddRTT(unsigned long rtt)
+	{
+		if (!measured || backoff)
+		{
+			srtt = rtt;
+			rttvar = rtt / 2;
+			measured = true;
+			backoff = false;
+		}
+		else
+		{
+			const unsigned long delta = (srtt > rtt ? srtt - rtt : rtt - srtt);
+			rttvar = (3 * rttvar + delta) / 4;
+			srtt = (7 * srtt + rtt) / 8;
+		}
+	}
+
+	/** Record that a query sent to this server has not been answered, so it is used less */
+	void AddTimeout()
+	{
+		timeouts++;
+		srtt = std::min(std::max(srtt * 2, ServerInstance->Config->dns_timeout * 1000UL), 60000UL);
+		measured = true;
+		backoff = true;
+	}
+};
+
 class MyManager : public Manager, public Timer, public EventHandler
 {
-	typedef TR1NS::unordered_map<Question, Query, Question::hash> cache_map;
+	/** A cached answer
+	 */
+	struct CacheEntry : public insp::intrusive_list_node<CacheEntry>
+	{
+		/** The key of this entry in the cache */
+		const Question* key;
+
+		/** The answer, or an error if the name or the records don't exist */
+		Query query;
+
+		/** The time after which this entry is no longer used */
+		time_t expires;
+
+		CacheEntry() : key(NULL), expires(0) { }
+	};
+
+	typedef TR1NS::unordered_map<Question, CacheEntry, Question::hash> cache_map;
 	cache_map cache;
 
-	irc::sockets::sockaddrs myserver;
+	/** The cache entries, from the most to the least recently used */
+	insp::intrusive_list_tail<CacheEntry> lru;
+
+	/** Maximum number of cache entries, 0 disables the cache */
+	unsigned long cachesize;
+
+	/** TTLs of cached answers are raised to at least minttl and lowered to at most maxttl seconds */
+	unsigned long minttl;
+	unsigned long maxttl;
+
+	/** Seconds to cache a negative answer which has no SOA record for, 0 to never cache negative answers */
+	unsigned long negativettl;
+
+	/** Cache statistics */
+	unsigned long cachehits;
+	unsigned long cachemisses;
+	unsigned long cacheevictions;
+
+	/** The nameservers queries are sent to, all of the same address family as the socket */
+	std::vector<NameServer> servers;
+
+	/** Maximum number of packets sent or received with one system call */
+	static const unsigned int MAX_BATCH = 32;
+
+	/** A packed query which is waiting to be sent to the nameserver */
+	struct PendingQuery
+	{
+		/** Id of the request, 0 if the request has been removed before the query was sent */
+		unsigned short id;
+		unsigned short len;
+		/** Index of the nameserver in servers to send the query to */
+		unsigned char server;
+		/** True if the query is sent because the first server has not answered in time */
+		bool race;
+		unsigned char data[524];
+	};
+
+	/** Where and when the query of a request has been sent */
+	struct InFlight
+	{
+		/** The time the query was sent to the first server, 0 if it has not been sent */
+		uint64_t sent;
+		/** The time the query was sent to a second server, 0 if it has not been raced */
+		uint64_t racesent;
+		unsigned char server;
+		unsigned char raceserver;
+	};
+
+	/** Sent queries, indexed by request id */
+	std::vector<InFlight> inflight;
+
+	/** Sends the queries which are due to be raced */
+	RaceTimer racetimer;
+
+	/** The time racetimer is set to tick at, 0 if it is not scheduled */
+	uint64_t racetime;
+
+	/** Queries made during this mainloop iteration, they are sent together when the socket is flushed */
+	std::vector<PendingQuery> outqueue;
+
+	/** The queries SendQueries() is sending. Queries made by the callbacks it runs go to outqueue, to be sent in the next batch. */
+	std::vector<PendingQuery> sending;
 
-	static bool IsExpired(const Query& record, time_t now = ServerInstance->Time())
+	/** Ids of the requests which have a query in outqueue or sending */
+	std::bitset<MAX_REQUEST_ID> queued;
+
+	/** Request ids which are not in use, in no particular order. Ids are taken from a random position. */
+	std::vector<unsigned short> freeids;
+
+	/** Cache a reply saying that a name or the records asked for don't exist
+	 * @param p The reply, with its error set
+	 */
+	void AddNegativeCache(const Packet& p)
+	{
+		/* A truncated reply may have been cut off before the records which were asked for */
+		if (!negativettl || (p.flags & QUERYFLAGS_TC))
+			return;
+
+		Query r;
+		r.questions = p.questions;
+		r.error = p.error;
+		AddCache(r, p.negativettl >= 0 ? p.negativettl : negativettl);
+	}
+
+	/** Remove an entry from the cache
+	 * @param it The entry to remove
+	 */
+	void RemoveCache(cache_map::iterator it)
 	{
-		const ResourceRecord& req = record.answers[0];
-		return (req.created + static_cast<time_t>(req.ttl) < now);
+		lru.erase(&it->second);
+		this->cache.erase(it);
 	}
 
 	/** Check the DNS cache to see if request can be handled by a cached result
@@ -416,38 +658,77 @@ class MyManager : public Manager, public Timer, public EventHandler
 
 		cache_map::iterator it = this->cache.find(question);
 		if (it == this->cache.end())
+		{
+			cachemisses++;
 			return false;
+		}
 
-		Query& record = it->second;
-		if (IsExpired(record))
+		CacheEntry& entry = it->second;
+		if (entry.expires < ServerInstance->Time())
 		{
-			this->cache.erase(it);
+			RemoveCache(it);
+			cachemisses++;
 			return false;
 		}
 
+		cachehits++;
+		lru.erase(&entry);
+		lru.push_front(&entry);
+
 		ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "cache: Using cached result for " + question.name);
-		record.cached = true;
-		req->OnLookupComplete(&record);
+		entry.query.cached = true;
+		if (entry.query.error == ERROR_NONE)
+			req->OnLookupComplete(&entry.query);
+		else
+			req->OnError(&entry.query);
 		return true;
 	}
 
-	/** Add a record to the dns cache
-	 * @param r The record
+	/** Add a record to the dns cache, evicting the least recently used entries if the cache is full
+	 * @param r The record, or a query with an error for a negative answer
+	 * @param ttl The number of seconds to keep the record for, before it is clamped to minttl and maxttl
 	 */
-	void AddCache(Query& r)
+	void AddCache(const Query& r, unsigned long ttl)
 	{
-		const ResourceRecord& rr = r.answers[0];
-		ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "cache: added cache for " + rr.name + " -> " + rr.rdata + " ttl: " + ConvToStr(rr.ttl));
-		this->cache[r.questions[0]] = r;
+		if (!cachesize || r.questions.empty())
+			return;
+
+		ttl = std::min(std::max(ttl, minttl), maxttl);
+		ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "cache: added cache for " + r.questions[0].name + (r.answers.empty() ? " (negative)" : " -> " + r.answers[0].rdata) + " ttl: " + ConvToStr(ttl));
+
+		std::pair<cache_map::iterator, bool> res = this->cache.insert(std::make_pair(r.questions[0], CacheEntry()));
+		CacheEntry& entry = res.first->second;
+		if (res.second)
+			entry.key = &res.first->first;
+		else
+			lru.erase(&entry);
+
+		entry.query = r;
+		entry.expires = ServerInstance->Time() + ttl;
+		lru.push_front(&entry);
+
+		while (this->cache.size() > cachesize)
+		{
+			CacheEntry* oldest = lru.back();
+			RemoveCache(this->cache.find(*oldest->key));
+			cacheevictions++;
+		}
 	}
 
  public:
 	DNS::Request* requests[MAX_REQUEST_ID];
 
-	MyManager(Module* c) : Manager(c), Timer(3600, true)
+	MyManager(Module* c) : Manager(c), Timer(3600, true), cachesize(0), minttl(0), maxttl(0), negativettl(0)
+		, cachehits(0), cachemisses(0), cacheevictions(0), racetimer(this), racetime(0)
 	{
+		inflight.resize(MAX_REQUEST_ID);
+		freeids.reserve(MAX_REQUEST_ID - 1);
 		for (int i = 0; i < MAX_REQUEST_ID; ++i)
+		{
 			requests[i] = NULL;
+			if (i)
+				freeids.push_back(i);
+		}
 		ServerInstance->Timers.AddTimer(this);
 	}
 
@@ -469,35 +750,35 @@ class MyManager : public Manager, public Timer, public EventHandler
 
 	void Process(DNS::Request* req)
 	{
-		ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Processing request to lookup " + req->name + " of type " + ConvToStr(req->type) + " to " + this->myserver.addr());
-
-		/* Create an id */
-		unsigned int tries = 0;
-		do
+		/* Try the cache before doing any work for a query, answers to PTR queries are cached under their arpa name */
+		if (req->use_cache)
 		{
-			req->id = ServerInstance->GenRandomInt(DNS::MAX_REQUEST_ID);
+			Question question(*req);
+			if (question.type == QUERY_PTR)
+				question.name = Packet::GetPTRName(question.name);
 
-			if (++tries == DNS::MAX_REQUEST_ID*5)
+			if (this->CheckCache(req, question))
 			{
-				// If we couldn't find an empty slot this many times, do a sequential scan as a last
-				// resort. If an empty slot is found that way, go on, otherwise throw an exception
-				req->id = 0;
-				for (int i = 1; i < DNS::MAX_REQUEST_ID; i++)
-				{
-					if (!this->requests[i])
-					{
-						req->id = i;
-						break;
-					}
-				}
-
-				if (req->id == 0)
-					throw Exception("DNS: All ids are in use");
-
-				break;
+				ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Using cached result");
+				delete req;
+				return;
 			}
 		}
-		while (!req->id || this->requests[req->id]);
+
+		if (this->GetFd() < 0 || servers.empty())
+			throw Exception("DNS: Unable to send query");
+
+		const unsigned int server = FindServer(servers.size());
+		ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Processing request to lookup " + req->name + " of type " + ConvToStr(req->type) + " to " + servers[server].addr.addr());
+
+		/* Create an id, picking a random one from the free ids keeps them unpredictable */
+		if (freeids.empty())
+			throw Exception("DNS: All ids are in use");
+
+		const size_t pos = ServerInstance->GenRandomInt(freeids.size());
+		req->id = freeids[pos];
+		freeids[pos] = freeids.back();
+		freeids.pop_back();
 
 		this->requests[req->id] = req;
 
@@ -509,23 +790,273 @@ class MyManager : public Manager, public Timer, public EventHandler
 		unsigned char buffer[524];
 		unsigned short len = p.Pack(buffer, sizeof(buffer));
 
-		/* Note that calling Pack() above can actually change the contents of p.questions[0].name, if the query is a PTR,
-		 * to contain the value that would be in the DNS cache, which is why this is here.
-		 */
-		if (req->use_cache && this->CheckCache(req, p.questions[0]))
+		QueueQuery(req->id, buffer, len, server, false);
+	}
+
+	/** Find the nameserver which is expected to answer the fastest
+	 * @param exclude Index of a server which should not be picked, or servers.size() to consider all servers
+	 * @return Index of the server in servers, or servers.size() if there is no server to pick
+	 */
+	unsigned int FindServer(unsigned int exclude) const
+	{
+		unsigned int best = servers.size();
+		for (unsigned int i = 0; i < servers.size(); ++i)
 		{
-			ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Using cached result");
-			delete req;
+			if (i == exclude)
+				continue;
+
+			// Servers which have not been measured yet are tried first
+			if (best == servers.size() || !servers[i].measured || (servers[best].measured && servers[i].srtt < servers[best].srtt))
+				best = i;
+			if (!servers[best].measured)
+				break;
+		}
+		return best;
+	}
+
+	/** Queue a query, all queries made during this mainloop iteration are sent at once
+	 * @param id The id of the request
+	 * @param data The packed query
+	 * @param len The length of the packed query
+	 * @param server Index of the nameserver to send the query to
+	 * @param race True if the query is sent because another server did not answer it in time
+	 */
+	void QueueQuery(unsigned short id, const unsigned char* data, unsigned short len, unsigned int server, bool race)
+	{
+		outqueue.push_back(PendingQuery());
+		PendingQuery& query = outqueue.back();
+		query.id = id;
+		query.len = len;
+		query.server = server;
+		query.race = race;
+		memcpy(query.data, data, len);
+		queued.set(id);
+
+		SocketEngine::ChangeEventMask(this, FD_ADD_TRIAL_WRITE);
+	}
+
+	/** Record that a query has been sent
+	 * @param query The query
+	 * @param now The current time as returned by TimerManager::GetTime()
+	 */
+	void OnQuerySent(const PendingQuery& query, uint64_t now)
+	{
+		InFlight& flight = inflight[query.id];
+		NameServer& ns = servers[query.server];
+		ns.queries++;
+		queued.reset(query.id);
+
+		if (query.race)
+		{
+			ns.races++;
+			flight.racesent = now;
+			flight.raceserver = query.server;
 			return;
 		}
 
-		if (SocketEngine::SendTo(this, buffer, len, 0, &this->myserver.sa, this->myserver.sa_size()) != len)
-			throw Exception("DNS: Unable to send query");
+		flight.sent = now;
+		flight.server = query.server;
+		flight.racesent = 0;
+
+		if (servers.size() < 2)
+			return;
+
+		// Ask another server if this one does not answer in time
+		NameServer::RaceEntry entry;
+		entry.deadline = now + ns.GetRaceDelay();
+		entry.sent = now;
+		entry.id = query.id;
+		ns.racequeue.push_back(entry);
+		if (!racetime || entry.deadline < racetime)
+		{
+			racetime = entry.deadline;
+			racetimer.SetIntervalMs(entry.deadline - now);
+		}
+	}
+
+	/** Send the queries which have not been answered by their server in time to another server
+	 */
+	void RaceQueries()
+	{
+		const uint64_t now = TimerManager::GetTime();
+		uint64_t next = 0;
+		for (unsigned int i = 0; i < servers.size(); ++i)
+		{
+			std::deque<NameServer::RaceEntry>& racequeue = servers[i].racequeue;
+			for (; !racequeue.empty() && racequeue.front().deadline <= now; racequeue.pop_front())
+			{
+				const NameServer::RaceEntry& entry = racequeue.front();
+				DNS::Request* req = this->requests[entry.id];
+				const InFlight& flight = inflight[entry.id];
+
+				// Answered, or the id has been reused by a later request
+				if (!req || flight.sent != entry.sent || flight.racesent)
+					continue;
+
+				const unsigned int server = FindServer(i);
+				if (server == servers.size())
+					continue;
+
+				Packet p;
+				p.flags = QUERYFLAGS_RD;
+				p.id = req->id;
+				p.questions.push_back(*req);
+
+				unsigned char buffer[524];
+				unsigned short len = p.Pack(buffer, sizeof(buffer));
+
+				ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "No answer from %s for %s after %lums, also asking %s", servers[i].addr.addr().c_str(),
+					req->name.c_str(), static_cast<unsigned long>(now - entry.sent), servers[server].addr.addr().c_str());
+				QueueQuery(req->id, buffer, len, server, true);
+			}
+
+			if (!racequeue.empty() && (!next || racequeue.front().deadline < next))
+				next = racequeue.front().deadline;
+		}
+
+		racetime = next;
+		if (next)
+			racetimer.SetIntervalMs(next - now);
 	}
 
 	void RemoveRequest(DNS::Request* req)
 	{
+		if (!req->id || this->requests[req->id] != req)
+			return;
+
 		this->requests[req->id] = NULL;
+		freeids.push_back(req->id);
+
+		/* The request is removed before an answer has arrived, e.g. because its module is unloading */
+		InFlight& flight = inflight[req->id];
+		flight.sent = flight.racesent = 0;
+
+		/* Don't send the query if it is still waiting to be sent */
+		if (queued.test(req->id))
+		{
+			for (std::vector<PendingQuery>::iterator i = outqueue.begin(); i != outqueue.end(); ++i)
+			{
+				if (i->id == req->id)
+					i->id = 0;
+			}
+			for (std::vector<PendingQuery>::iterator i = sending.begin(); i != sending.end(); ++i)
+			{
+				if (i->id == req->id)
+					i->id = 0;
+			}
+			queued.reset(req->id);
+		}
+	}
+
+	void OnTimeout(DNS::Request* req)
+	{
+		if (!req->id || this->requests[req->id] != req)
+			return;
+
+		/* Only the servers which were asked and did not answer in time are used less */
+		InFlight& flight = inflight[req->id];
+		if (flight.sent)
+		{
+			servers[flight.server].AddTimeout();
+			if (flight.racesent)
+				servers[flight.raceserver].AddTimeout();
+			flight.sent = flight.racesent = 0;
+		}
+	}
+
+	/** Send the queued queries to the nameserver
+	 */
+	void SendQueries()
+	{
+		sending.swap(outqueue);
+		size_t sent = 0;
+		while (sent < sending.size())
+		{
+			if (!sending[sent].id)
+			{
+				// The request was removed before its query was sent
+				sent++;
+				continue;
+			}
+
+			int rv;
+#ifdef HAS_SENDMMSG
+			// Send the queries up to the next one which was removed in one call
+			mmsghdr msgs[MAX_BATCH];
+			iovec iovs[MAX_BATCH];
+			unsigned int count = 0;
+			while (count < MAX_BATCH && sent + count < sending.size() && sending[sent + count].id)
+			{
+				PendingQuery& query = sending[sent + count];
+				iovs[count].iov_base = query.data;
+				iovs[count].iov_len = query.len;
+				memset(&msgs[count], 0, sizeof(msgs[count]));
+				irc::sockets::sockaddrs& addr = servers[query.server].addr;
+				msgs[count].msg_hdr.msg_name = &addr.sa;
+				msgs[count].msg_hdr.msg_namelen = addr.sa_size();
+				msgs[count].msg_hdr.msg_iov = &iovs[count];
+				msgs[count].msg_hdr.msg_iovlen = 1;
+				count++;
+			}
+
+			rv = sendmmsg(this->GetFd(), msgs, count, 0);
+			if (rv > 0)
+			{
+				const uint64_t now = TimerManager::GetTime();
+				for (int i = 0; i < rv; i++)
+				{
+					SocketEngine::UpdateStats(0, msgs[i].msg_len);
+					OnQuerySent(sending[sent + i], now);
+				}
+				sent += rv;
+				continue;
+			}
+#else
+			const PendingQuery& query = sending[sent];
+			irc::sockets::sockaddrs& addr = servers[query.server].addr;
+			rv = SocketEngine::SendTo(this, query.data, query.len, 0, &addr.sa, addr.sa_size());
+			if (rv == query.len)
+			{
+				OnQuerySent(query, TimerManager::GetTime());
+				sent++;
+				continue;
+			}
+#endif
+
+			if (rv < 0 && SocketEngine::IgnoreError())
+			{
+				/* Send the rest when the socket becomes writable, before the queries made since this batch started */
+				outqueue.insert(outqueue.begin(), sending.begin() + sent, sending.end());
+				sending.clear();
+				SocketEngine::ChangeEventMask(this, FD_WANT_FAST_WRITE | FD_WRITE_WILL_BLOCK);
+				return;
+			}
+
+			/* The first server may still answer if this was a race */
+			if (sending[sent].race)
+			{
+				ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Unable to send query to %s: %s",
+					servers[sending[sent].server].addr.addr().c_str(), SocketEngine::LastError().c_str());
+				queued.reset(sending[sent].id);
+				sent++;
+				continue;
+			}
+
+			/* This query can't be sent, fail its request now rather than letting it time out */
+			DNS::Request* request = this->requests[sending[sent].id];
+			queued.reset(sending[sent].id);
+			sent++;
+
+			ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Unable to send query for " + request->name + ": " + SocketEngine::LastError());
+			Query rr(*request);
+			rr.error = ERROR_UNKNOWN;
+			request->OnError(&rr);
+			delete request;
+		}
+
+		sending.clear();
+		if (outqueue.empty())
+			SocketEngine::ChangeEventMask(this, FD_WANT_NO_WRITE);
 	}
 
 	std::string GetErrorStr(Error e)
@@ -563,12 +1094,67 @@ class MyManager : public Manager, public Timer, public EventHandler
 			return;
 		}
 
-		unsigned char buffer[524];
-		irc::sockets::sockaddrs from;
-		socklen_t x = sizeof(from);
+		if (et == EVENT_WRITE)
+		{
+			SendQueries();
+			return;
+		}
+
+		/* Read all replies which have arrived */
+#ifdef HAS_SENDMMSG
+		unsigned char buffers[MAX_BATCH][524];
+		irc::sockets::sockaddrs from[MAX_BATCH];
+		mmsghdr msgs[MAX_BATCH];
+		iovec iovs[MAX_BATCH];
+		for (;;)
+		{
+			for (unsigned int i = 0; i < MAX_BATCH; i++)
+			{
+				iovs[i].iov_base = buffers[i];
+				iovs[i].iov_len = sizeof(buffers[i]);
+				memset(&msgs[i], 0, sizeof(msgs[i]));
+				msgs[i].msg_hdr.msg_name = &from[i].sa;
+				msgs[i].msg_hdr.msg_namelen = sizeof(from[i]);
+				msgs[i].msg_hdr.msg_iov = &iovs[i];
+				msgs[i].msg_hdr.msg_iovlen = 1;
+			}
 
-		int length = SocketEngine::RecvFrom(this, buffer, sizeof(buffer), 0, &from.sa, &x);
+			int count = recvmmsg(this->GetFd(), msgs, MAX_BATCH, 0, NULL);
+			if (count <= 0)
+				break;
+
+			for (int i = 0; i < count; i++)
+			{
+				SocketEngine::UpdateStats(msgs[i].msg_len, 0);
+				HandleReply(buffers[i], msgs[i].msg_len, from[i]);
+			}
+
+			if (count < static_cast<int>(MAX_BATCH))
+				break;
+		}
+#else
+		for (;;)
+		{
+			unsigned char buffer[524];
+			irc::sockets::sockaddrs from;
+			socklen_t x = sizeof(from);
+
+			int length = SocketEngine::RecvFrom(this, buffer, sizeof(buffer), 0, &from.sa, &x);
+			if (length < 0)
+				break;
+
+			HandleReply(buffer, length, from);
+		}
+#endif
+	}
 
+	/** Match a reply from the nameserver to its request and complete the request
+	 * @param buffer The packet which was received
+	 * @param length The length of the packet
+	 * @param from The address the packet was sent from
+	 */
+	void HandleReply(const unsigned char* buffer, int length, const irc::sockets::sockaddrs& from)
+	{
 		if (length < Packet::HEADER_LENGTH)
 			return;
 
@@ -584,22 +1170,46 @@ class MyManager : public Manager, public Timer, public EventHandler
 			return;
 		}
 
-		if (myserver != from)
+		DNS::Request* request = this->requests[recv_packet.id];
+		InFlight& flight = inflight[recv_packet.id];
+		if (request == NULL || !flight.sent)
 		{
-			std::string server1 = from.str();
-			std::string server2 = myserver.str();
-			ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Got a result from the wrong server! Bad NAT or DNS forging attempt? '%s' != '%s'",
-				server1.c_str(), server2.c_str());
+			ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Received an answer for something we didn't request");
 			return;
 		}
 
-		DNS::Request* request = this->requests[recv_packet.id];
-		if (request == NULL)
+		/* Only the servers the query was sent to may answer it */
+		uint64_t sent;
+		unsigned int server;
+		if (servers[flight.server].addr == from)
 		{
-			ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Received an answer for something we didn't request");
+			sent = flight.sent;
+			server = flight.server;
+		}
+		else if (flight.racesent && servers[flight.raceserver].addr == from)
+		{
+			sent = flight.racesent;
+			server = flight.raceserver;
+		}
+		else
+		{
+			std::string server1 = from.str();
+			std::string server2 = servers[flight.server].addr.str();
+			ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Got a result from the wrong server! Bad NAT or DNS forging attempt? '%s' != '%s'",
+				server1.c_str(), server2.c_str());
 			return;
 		}
 
+		const uint64_t now = TimerManager::GetTime();
+		NameServer& ns = servers[server];
+		ns.replies++;
+		ns.AddRTT(now - sent);
+
+		/* The first server lost the race, it would have taken at least this long to answer */
+		if (server != flight.server)
+			servers[flight.server].AddRTT(now - flight.sent);
+		flight.sent = flight.racesent = 0;
+
 		if (recv_packet.flags & QUERYFLAGS_OPCODE)
 		{
 			ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Received a nonstandard query");
@@ -640,6 +1250,8 @@ class MyManager : public Manager, public Timer, public EventHandler
 			ServerInstance->stats.DnsBad++;
 			recv_packet.error = error;
 			request->OnError(&recv_packet);
+			if (error == ERROR_DOMAIN_NOT_FOUND)
+				this->AddNegativeCache(recv_packet);
 		}
 		else if (recv_packet.questions.empty() || recv_packet.answers.empty())
 		{
@@ -647,13 +1259,14 @@ class MyManager : public Manager, public Timer, public EventHandler
 			ServerInstance->stats.DnsBad++;
 			recv_packet.error = ERROR_NO_RECORDS;
 			request->OnError(&recv_packet);
+			this->AddNegativeCache(recv_packet);
 		}
 		else
 		{
 			ServerInstance->Logs->Log(MODNAME, LOG_DEBUG, "Lookup complete for " + request->name);
 			ServerInstance->stats.DnsGood++;
 			request->OnLookupComplete(&recv_packet);
-			this->AddCache(recv_packet);
+			this->AddCache(recv_packet, recv_packet.answers[0].ttl);
 		}
 
 		ServerInstance->stats.Dns++;
@@ -668,16 +1281,19 @@ class MyManager : public Manager, public Timer, public EventHandler
 
 		for (cache_map::iterator it = this->cache.begin(); it != this->cache.end(); )
 		{
-			const Query& query = it->second;
-			if (IsExpired(query, now))
-				this->cache.erase(it++);
+			if (it->second.expires < now)
+				RemoveCache(it++);
 			else
 				++it;
 		}
+
+		/* Give servers which have been slow or have not answered another chance */
+		for (std::vector<NameServer>::iterator i = servers.begin(); i != servers.end(); ++i)
+			i->srtt /= 2;
 		return true;
 	}
 
-	void Rehash(const std::string& dnsserver)
+	void Rehash(const std::string& dnsservers)
 	{
 		if (this->GetFd() > -1)
 		{
@@ -688,10 +1304,48 @@ class MyManager : public Manager, public Timer, public EventHandler
 			this->Tick(ServerInstance->Time());
 		}
 
-		irc::sockets::aptosa(dnsserver, DNS::PORT, myserver);
+		/* Queries which are still waiting for an answer can't be raced or measured against the new servers */
+		for (int i = 0; i < MAX_REQUEST_ID; ++i)
+			inflight[i].sent = inflight[i].racesent = 0;
+		for (std::vector<PendingQuery>::iterator i = outqueue.begin(); i != outqueue.end(); ++i)
+			queued.reset(i->id);
+		outqueue.clear();
+
+		servers.clear();
+		racetime = 0;
+		ServerInstance->Timers.DelTimer(&racetimer);
+		irc::spacesepstream serverstream(dnsservers);
+		for (std::string dnsserver; serverstream.GetToken(dnsserver); )
+		{
+			irc::sockets::sockaddrs addr;
+			if (!irc::sockets::aptosa(dnsserver, DNS::PORT, addr))
+			{
+				ServerInstance->Logs->Log(MODNAME, LOG_DEFAULT, "Ignoring invalid DNS server address '%s'", dnsserver.c_str());
+				continue;
+			}
+
+			// All servers share one socket, so they must use the address family of the first one
+			if (!servers.empty() && addr.sa.sa_family != servers[0].addr.sa.sa_family)
+			{
+				ServerInstance->Logs->Log(MODNAME, LOG_DEFAULT, "Ignoring DNS server %s, it is not of the same address family as %s",
+					dnsserver.c_str(), servers[0].addr.addr().c_str());
+				continue;
+			}
+
+			if (servers.size() > UCHAR_MAX)
+				break;
+
+			servers.push_back(NameServer(addr));
+		}
+
+		if (servers.empty())
+		{
+			ServerInstance->Logs->Log(MODNAME, LOG_SPARSE, "No valid DNS server - hostnames will NOT resolve");
+			return;
+		}
 
 		/* Initialize mastersocket */
-		int s = socket(myserver.sa.sa_family, SOCK_DGRAM, 0);
+		int s = socket(servers[0].addr.sa.sa_family, SOCK_DGRAM, 0);
 		this->SetFd(s);
 
 		/* Have we got a socket? */
@@ -702,7 +1356,7 @@ class MyManager : public Manager, public Timer, public EventHandler
 
 			irc::sockets::sockaddrs bindto;
 			memset(&bindto, 0, sizeof(bindto));
-			bindto.sa.sa_family = myserver.sa.sa_family;
+			bindto.sa.sa_family = servers[0].addr.sa.sa_family;
 
 			if (SocketEngine::Bind(this->GetFd(), bindto) < 0)
 			{
@@ -723,8 +1377,54 @@ class MyManager : public Manager, public Timer, public EventHandler
 			ServerInstance->Logs->Log(MODNAME, LOG_SPARSE, "Error creating DNS socket - hostnames will NOT resolve");
 		}
 	}
+
+	/** Set the limits of the cache, evicting entries if it is now too big
+	 * @param size Maximum number of entries, 0 to disable the cache
+	 * @param min Minimum number of seconds to cache an answer for
+	 * @param max Maximum number of seconds to cache an answer for
+	 * @param negative Seconds to cache a negative answer without a SOA record for, 0 to never cache negative answers
+	 */
+	void SetCacheLimits(unsigned long size, unsigned long min, unsigned long max, unsigned long negative)
+	{
+		cachesize = size;
+		minttl = min;
+		maxttl = std::max(min, max);
+		negativettl = negative;
+
+		while (this->cache.size() > cachesize)
+		{
+			CacheEntry* oldest = lru.back();
+			RemoveCache(this->cache.find(*oldest->key));
+			cacheevictions++;
+		}
+	}
+
+	/** Add the statistics of each nameserver to a STATS reply
+	 * @param nick The nick of the user the reply is sent to
+	 * @param results The STATS reply
+	 */
+	void GetStats(const std::string& nick, string_list& results) const
+	{
+		results.push_back("249 " + nick + " :DNS cache entries " + ConvToStr(this->cache.size()) + "/" + ConvToStr(cachesize) + " hits " + ConvToStr(cachehits) +
+			" misses " + ConvToStr(cachemisses) + " evictions " + ConvToStr(cacheevictions));
+
+		for (std::vector<NameServer>::const_iterator i = servers.begin(); i != servers.end(); ++i)
+		{
+			const NameServer& ns = *i;
+			results.push_back("249 " + nick + " :DNS server " + ns.addr.addr() + " queries " + ConvToStr(ns.queries) + " replies " + ConvToStr(ns.replies) +
+				" races " + ConvToStr(ns.races) + " timeouts " + ConvToStr(ns.timeouts) + " srtt " + (ns.measured ? ConvToStr(ns.srtt) + "ms" : "unknown") +
+				" rttvar " + ConvToStr(ns.rttvar) + "ms");
+		}
+	}
+
 };
 
+bool RaceTimer::Tick(time_t now)
+{
+	manager->RaceQueries();
+	return true;
+}
+
 class ModuleDNS : public Module
 {
 	MyManager manager;
@@ -770,19 +1470,27 @@ class ModuleDNS : public Module
 
 		std::ifstream resolv("/etc/resolv.conf");
 
-		while (resolv >> DNSServer)
+		std::string token;
+		while (resolv >> token)
 		{
-			if (DNSServer == "nameserver")
+			if (token == "nameserver")
 			{
-				resolv >> DNSServer;
-				if (DNSServer.find_first_not_of("0123456789.") == std::string::npos)
+				resolv >> token;
+				if (token.find_first_not_of("0123456789.") == std::string::npos)
 				{
-					ServerInstance->Logs->Log("CONFIG", LOG_DEFAULT, "<dns:server> set to '%s' as first resolver in /etc/resolv.conf.",DNSServer.c_str());
-					return;
+					if (!DNSServer.empty())
+						DNSServer.push_back(' ');
+					DNSServer.append(token);
 				}
 			}
 		}
 
+		if (!DNSServer.empty())
+		{
+			ServerInstance->Logs->Log("CONFIG", LOG_DEFAULT, "<dns:server> set to '%s' from the resolvers in /etc/resolv.conf.", DNSServer.c_str());
+			return;
+		}
+
 		ServerInstance->Logs->Log("CONFIG", LOG_DEFAULT, "/etc/resolv.conf contains no viable nameserver entries! Defaulting to nameserver '127.0.0.1'!");
 #endif
 		DNSServer = "127.0.0.1";
@@ -795,8 +1503,12 @@ class ModuleDNS : public Module
 
 	void ReadConfig(ConfigStatus& status) CXX11_OVERRIDE
 	{
+		ConfigTag* tag = ServerInstance->Config->ConfValue("dns");
+		this->manager.SetCacheLimits(tag->getInt("cachesize", 10000, 0), tag->getDuration("minttl", 0, 0),
+			tag->getDuration("maxttl", 86400, 0), tag->getDuration("negativettl", 300, 0));
+
 		std::string oldserver = DNSServer;
-		DNSServer = ServerInstance->Config->ConfValue("dns")->getString("server");
+		DNSServer = tag->getString("server");
 		if (DNSServer.empty())
 			FindDNSServer();
 
@@ -804,6 +1516,14 @@ class ModuleDNS : public Module
 			this->manager.Rehash(DNSServer);
 	}
 
+	ModResult OnStats(char symbol, User* user, string_list& results) CXX11_OVERRIDE
+	{
+		if (symbol == 'D')
+			this->manager.GetStats(user->nick, results);
+
+		return MOD_RES_PASSTHRU;
+	}
+
 	void OnUnloadModule(Module* mod)
 	{
 		for (int i = 0; i < MAX_REQUEST_ID; ++i)
@@ -96,6 +96,7 @@ class UserResolver : public DNS::Request
 
 				bound_user->WriteNotice("*** There was an internal error resolving your host, using your IP address (" + bound_user->GetIPString() + ") instead.");
 				dl->set(bound_user, 0);
+				bound_user->CheckReady();
 			}
 		}
 		else
@@ -122,6 +123,7 @@ class UserResolver : public DNS::Request
 			}
 
 			dl->set(bound_user, 0);
+			bound_user->CheckReady();
 
 			if (rev_match)
 			{
@@ -140,11 +142,7 @@ class UserResolver : public DNS::Request
 						hostname->insert(0, "0");
 
 					bound_user->WriteNotice("*** Found your hostname (" + *hostname + (r->cached ? ") -- cached" : ")"));
-					bound_user->host.assign(*hostname, 0, ServerInstance->Config->Limits.MaxHost);
-					bound_user->dhost = bound_user->host;
-
-					/* Invalidate cache */
-					bound_user->InvalidateCache();
+					bound_user->ChangeRealHost(*hostname, true);
 				}
 				else
 				{
@@ -170,6 +168,7 @@ class UserResolver : public DNS::Request
 		{
 			bound_user->WriteNotice("*** Could not resolve your hostname: " + this->manager->GetErrorStr(query->error) + "; using your IP address (" + bound_user->GetIPString() + ") instead.");
 			dl->set(bound_user, 0);
+			bound_user->CheckReady();
 			ServerInstance->stats.DnsBad++;
 		}
 	}
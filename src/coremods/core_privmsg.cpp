@@ -142,7 +142,9 @@ CmdResult MessageCommandBase::HandleMessage(const std::vector<std::string>& para
 
 				if (ServerInstance->Config->RestrictBannedUsers)
 				{
-					if (chan->IsBanned(user))
+					// Members can use the verdict cached in their Membership
+					Membership* memb = chan->GetUser(user);
+					if (memb ? memb->IsBanned() : chan->IsBanned(user))
 					{
 						user->WriteNumeric(ERR_CANNOTSENDTOCHAN, "%s :Cannot send to channel (you're banned)", chan->name.c_str());
 						return CMD_FAILURE;
@@ -103,7 +103,8 @@ void CommandStats::DoStats(char statschar, User* user, string_list &results)
 				std::string hook = ls->bind_tag->getString("ssl", "plaintext");
 
 				results.push_back("249 "+user->nick+" :"+ ip + ":"+ConvToStr(ls->bind_port)+
-					" (" + type + ", " + hook + ")");
+					" (" + type + ", " + hook + ") accepted " + ConvToStr(ls->accepted) +
+					" rejected " + ConvToStr(ls->rejected) + " drained " + ConvToStr(ls->drained));
 			}
 		}
 		break;
@@ -310,8 +311,10 @@ void CommandStats::DoStats(char statschar, User* user, string_list &results)
 			results.push_back("249 "+user->nick+" :nick collisions "+ConvToStr(ServerInstance->stats.Collisions));
 			results.push_back("249 "+user->nick+" :dns requests "+ConvToStr(ServerInstance->stats.DnsGood+ServerInstance->stats.DnsBad)+" succeeded "+ConvToStr(ServerInstance->stats.DnsGood)+" failed "+ConvToStr(ServerInstance->stats.DnsBad));
 			results.push_back("249 "+user->nick+" :connection count "+ConvToStr(ServerInstance->stats.Connects));
+			results.push_back("249 "+user->nick+" :timers "+ConvToStr(ServerInstance->Timers.GetTimerCount())+" expirations per second "+ConvToStr(ServerInstance->Timers.GetExpiredPerSecond()));
 			results.push_back(InspIRCd::Format("249 %s :bytes sent %5.2fK recv %5.2fK", user->nick.c_str(),
 				ServerInstance->stats.Sent / 1024.0, ServerInstance->stats.Recv / 1024.0));
+			results.push_back("249 "+user->nick+" :corked writes "+ConvToStr(ServerInstance->stats.Corked));
 		}
 		break;
 
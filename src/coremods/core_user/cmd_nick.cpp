@@ -74,8 +74,9 @@ CmdResult CommandNick::HandleLocal(const std::vector<std::string>& parameters, L
 	{
 		for (User::ChanList::iterator i = user->chans.begin(); i != user->chans.end(); ++i)
 		{
-			Channel* chan = (*i)->chan;
-			if (chan->GetPrefixValue(user) < VOICE_VALUE && chan->IsBanned(user))
+			Membership* memb = *i;
+			Channel* chan = memb->chan;
+			if (memb->getRank() < VOICE_VALUE && memb->IsBanned())
 			{
 				user->WriteNumeric(ERR_CANNOTSENDTOCHAN, "%s :Cannot send to channel (you're banned)", chan->name.c_str());
 				return CMD_FAILURE;
@@ -75,6 +75,8 @@ CmdResult CommandUser::CheckRegister(LocalUser* user)
 		FIRST_MOD_RESULT(OnUserRegister, MOD_RESULT, (user));
 		if (MOD_RESULT == MOD_RES_DENY)
 			return CMD_FAILURE;
+
+		user->CheckReady();
 	}
 
 	return CMD_SUCCESS;
@@ -304,6 +304,38 @@ bool irc::tokenstream::GetToken(long &token)
 	return returnval;
 }
 
+void irc::tokenize(const std::string& line, tokenlist& tokens)
+{
+	const char* pos = line.data();
+	const char* const end = pos + line.length();
+	bool first = true;
+
+	while (pos != end)
+	{
+		if (*pos == ' ')
+		{
+			++pos;
+			continue;
+		}
+
+		/* This is the last parameter, it runs until the end of the line */
+		if ((*pos == ':') && (!first))
+		{
+			++pos;
+			tokens.push_back(tokenview(pos, end - pos));
+			return;
+		}
+
+		const char* tokenend = static_cast<const char*>(memchr(pos, ' ', end - pos));
+		if (!tokenend)
+			tokenend = end;
+
+		tokens.push_back(tokenview(pos, tokenend - pos));
+		pos = tokenend;
+		first = false;
+	}
+}
+
 irc::sepstream::sepstream(const std::string& source, char separator, bool allowempty)
 	: tokens(source), sep(separator), pos(0), allow_empty(allowempty)
 {
@@ -114,6 +114,7 @@ void InspIRCd::Cleanup()
 		Users->QuitUser(*i, "Server shutdown");
 
 	GlobalCulls.Apply();
+	IOThreads.Stop();
 	Modules->UnloadAll();
 
 	/* Delete objects dynamically allocated in constructor (destructor would be more appropriate, but we're likely exiting) */
@@ -130,6 +131,13 @@ void InspIRCd::Cleanup()
 	Logs->CloseLogs();
 }
 
+InspIRCd::~InspIRCd()
+{
+	// The members are destroyed after this, and the destructors of classbase and static objects
+	// log through ServerInstance if it is set
+	ServerInstance = NULL;
+}
+
 void InspIRCd::SetSignals()
 {
 #ifndef _WIN32
@@ -574,6 +582,9 @@ InspIRCd::InspIRCd(int argc, char** argv) :
 
 	this->WritePID(Config->PID);
 #endif
+
+	// Threads don't survive DaemonSeed(), so this must be done after it
+	IOThreads.Start(Config->IOThreads);
 }
 
 void InspIRCd::UpdateTime()
@@ -632,6 +643,9 @@ void InspIRCd::Run()
 
 		UpdateTime();
 
+		/* Timers have millisecond precision, so they are checked every iteration */
+		Timers.TickTimers(TIME.tv_sec);
+
 		/* Run background module timers every few seconds
 		 * (the docs say modules shouldnt rely on accurate
 		 * timing using this event, so we dont have to
@@ -674,9 +688,6 @@ void InspIRCd::Run()
 				FOREACH_MOD(OnGarbageCollect, ());
 			}
 
-			Timers.TickTimers(TIME.tv_sec);
-			Users->DoBackgroundUserStuff();
-
 			if ((TIME.tv_sec % 5) == 0)
 			{
 				FOREACH_MOD(OnBackgroundTimer, (TIME.tv_sec));
@@ -692,6 +703,7 @@ void InspIRCd::Run()
 		 * dispatched to their handlers.
 		 */
 		SocketEngine::DispatchTrialWrites();
+		IOThreads.Flush();
 		SocketEngine::DispatchEvents();
 
 		/* if any users were quit, take them out */
@@ -29,6 +29,10 @@
 #include <sys/uio.h>
 #endif
 
+#ifndef _WIN32
+#include <netinet/tcp.h>
+#endif
+
 #ifndef IOV_MAX
 #define IOV_MAX 1024
 #endif
@@ -134,8 +138,16 @@ void StreamSocket::Close()
 			delete iohook;
 			DelIOHook();
 		}
-		SocketEngine::Shutdown(this, 2);
-		SocketEngine::Close(this);
+		if (threadconn)
+		{
+			// The I/O thread closes the file descriptor once it has written the remaining data
+			ServerInstance->IOThreads.Detach(this);
+		}
+		else
+		{
+			SocketEngine::Shutdown(this, 2);
+			SocketEngine::Close(this);
+		}
 	}
 }
 
@@ -145,20 +157,86 @@ CullResult StreamSocket::cull()
 	return EventHandler::cull();
 }
 
+size_t RecvQueue::find(char c, size_t pos) const
+{
+	if (pos >= length())
+		return npos;
+	const char* found = static_cast<const char*>(memchr(data() + pos, c, length() - pos));
+	return (found ? found - data() : npos);
+}
+
+std::string RecvQueue::substr(size_t pos, size_t n) const
+{
+	if (pos >= length())
+		return std::string();
+	return std::string(data() + pos, std::min(n, length() - pos));
+}
+
+char* RecvQueue::GetWriteBuffer(size_t size)
+{
+	if (capacity - end >= size)
+		return buffer + end;
+
+	const size_t len = length();
+	if (len + size <= capacity && len <= capacity / 2)
+	{
+		// There is enough consumed space at the front, move the data there. This happens at most
+		// once per half a buffer worth of consumed data, keeping the cost linear.
+		memmove(buffer, buffer + start, len);
+	}
+	else
+	{
+		size_t newcapacity = std::max(capacity * 2, len + size);
+		char* newbuffer = new char[newcapacity];
+		if (len)
+			memcpy(newbuffer, buffer + start, len);
+		delete[] buffer;
+		buffer = newbuffer;
+		capacity = newcapacity;
+	}
+	start = 0;
+	end = len;
+	return buffer + end;
+}
+
+void RecvQueue::append(const char* text, size_t len)
+{
+	memcpy(GetWriteBuffer(len), text, len);
+	Commit(len);
+}
+
+void RecvQueue::Consume(size_t len)
+{
+	start += std::min(len, length());
+	if (start == end)
+		start = end = 0;
+}
+
+void RecvQueue::clear()
+{
+	delete[] buffer;
+	buffer = NULL;
+	capacity = start = end = 0;
+}
+
 bool StreamSocket::GetNextLine(std::string& line, char delim)
 {
-	std::string::size_type i = recvq.find(delim);
-	if (i == std::string::npos)
+	size_t i = recvq.find(delim);
+	if (i == RecvQueue::npos)
 		return false;
-	line = recvq.substr(0, i);
-	// TODO is this the most efficient way to split?
-	recvq = recvq.substr(i + 1);
+	line.assign(recvq.data(), i);
+	recvq.Consume(i + 1);
 	return true;
 }
 
 void StreamSocket::DoRead()
 {
-	if (GetIOHook())
+	if (threadconn)
+	{
+		if (ServerInstance->IOThreads.Read(this))
+			OnDataReady();
+	}
+	else if (GetIOHook())
 	{
 		int rv = -1;
 		try
@@ -178,18 +256,19 @@ void StreamSocket::DoRead()
 	}
 	else
 	{
-		char* ReadBuffer = ServerInstance->GetReadBuffer();
+		// Receive straight into the recvq
+		char* ReadBuffer = recvq.GetWriteBuffer(ServerInstance->Config->NetBufferSize);
 		int n = SocketEngine::Recv(this, ReadBuffer, ServerInstance->Config->NetBufferSize, 0);
 		if (n == ServerInstance->Config->NetBufferSize)
 		{
 			SocketEngine::ChangeEventMask(this, FD_WANT_FAST_READ | FD_ADD_TRIAL_READ);
-			recvq.append(ReadBuffer, n);
+			recvq.Commit(n);
 			OnDataReady();
 		}
 		else if (n > 0)
 		{
 			SocketEngine::ChangeEventMask(this, FD_WANT_FAST_READ);
-			recvq.append(ReadBuffer, n);
+			recvq.Commit(n);
 			OnDataReady();
 		}
 		else if (n == 0)
@@ -213,9 +292,152 @@ void StreamSocket::DoRead()
 	}
 }
 
+namespace
+{
+	/** Storage larger than this is not kept for reuse, lines sent to clients are much shorter */
+	const size_t SPARE_STORAGE_MAX = 1024;
+
+	/** Storage smaller than this is not kept for reuse, it is inside the std::string object */
+	const size_t SPARE_STORAGE_MIN = 64;
+
+	/** Maximum number of pieces of storage kept for reuse */
+	const size_t SPARE_STORAGE_COUNT = 1024;
+
+	/** Storage of the data of freed SendBuffers.
+	 * This and the pool below are never destroyed because SendBuffers may be freed after
+	 * static objects have been destroyed on shutdown.
+	 */
+	std::vector<std::string>& GetSpareStorage()
+	{
+		static std::vector<std::string>* spare = new std::vector<std::string>;
+		return *spare;
+	}
+
+	insp::object_pool<SendBuffer>& GetSendBufferPool()
+	{
+		static insp::object_pool<SendBuffer>* pool = new insp::object_pool<SendBuffer>;
+		return *pool;
+	}
+}
+
+SendBuffer::SendBuffer()
+	: refcount(0)
+{
+	std::vector<std::string>& spare = GetSpareStorage();
+	if (!spare.empty())
+	{
+		data.swap(spare.back());
+		spare.pop_back();
+	}
+}
+
+SendBuffer::~SendBuffer()
+{
+	const size_t capacity = data.capacity();
+	if ((capacity < SPARE_STORAGE_MIN) || (capacity > SPARE_STORAGE_MAX))
+		return;
+
+	std::vector<std::string>& spare = GetSpareStorage();
+	if (spare.size() < SPARE_STORAGE_COUNT)
+	{
+		data.clear();
+		spare.push_back(std::string());
+		spare.back().swap(data);
+	}
+}
+
+void* SendBuffer::operator new(size_t size)
+{
+	if (size != sizeof(SendBuffer))
+		return ::operator new(size);
+	return GetSendBufferPool().allocate();
+}
+
+void SendBuffer::operator delete(void* ptr, size_t size)
+{
+	if (size != sizeof(SendBuffer))
+		::operator delete(ptr);
+	else
+		GetSendBufferPool().deallocate(ptr);
+}
+
 /* Don't try to prepare huge blobs of data to send to a blocked socket */
 static const int MYIOV_MAX = IOV_MAX < 128 ? IOV_MAX : 128;
 
+/* Buffers shorter than this are copied together by CoalesceSendQ(), up to COALESCE_SEGMENT bytes each */
+static const size_t COALESCE_MIN = 1024;
+static const size_t COALESCE_SEGMENT = 16384;
+
+void StreamSocket::CoalesceSendQ()
+{
+	std::vector<reference<SendBuffer> > merged;
+	std::string segment;
+	size_t newoffset = sendq_offset;
+	size_t count = 0;
+	for (; count < sendq.size() && merged.size() < (size_t)MYIOV_MAX - 1; count++)
+	{
+		const reference<SendBuffer>& buffer = sendq[count];
+		const size_t offset = (count == 0 ? sendq_offset : 0);
+		const size_t length = buffer->GetData().length() - offset;
+		if (length >= COALESCE_MIN)
+		{
+			if (!segment.empty())
+			{
+				merged.push_back(new SendBuffer(segment));
+				segment.clear();
+			}
+			merged.push_back(buffer);
+			continue;
+		}
+
+		if (segment.length() + length > COALESCE_SEGMENT)
+		{
+			merged.push_back(new SendBuffer(segment));
+			segment.clear();
+		}
+		if (segment.empty())
+			segment.reserve(COALESCE_SEGMENT);
+		segment.append(buffer->GetData(), offset, std::string::npos);
+		if (count == 0)
+			newoffset = 0;
+	}
+	if (!segment.empty())
+		merged.push_back(new SendBuffer(segment));
+
+	// Nothing was copied
+	if (merged.size() == count)
+		return;
+
+	sendq.erase(sendq.begin(), sendq.begin() + count);
+	sendq.insert(sendq.begin(), merged.begin(), merged.end());
+	sendq_offset = newoffset;
+}
+
+/* Hold back partial packets on a socket until it is uncorked, where the OS supports it */
+static void SetCork(int fd, int enable)
+{
+#if defined TCP_CORK
+	setsockopt(fd, IPPROTO_TCP, TCP_CORK, &enable, sizeof(enable));
+#elif defined TCP_NOPUSH
+	setsockopt(fd, IPPROTO_TCP, TCP_NOPUSH, &enable, sizeof(enable));
+#endif
+}
+
+std::string& StreamSocket::UnshareSendQFront()
+{
+	reference<SendBuffer>& front = sendq.front();
+	if (front->IsShared())
+	{
+		front = new SendBuffer(front->data.substr(sendq_offset));
+	}
+	else if (sendq_offset)
+	{
+		front->data.erase(0, sendq_offset);
+	}
+	sendq_offset = 0;
+	return front->data;
+}
+
 void StreamSocket::DoWrite()
 {
 	if (sendq.empty())
@@ -226,6 +448,13 @@ void StreamSocket::DoWrite()
 		return;
 	}
 
+	if (threadconn)
+	{
+		// The buffers themselves are passed to the I/O thread, even the ones shared with other sockets
+		ServerInstance->IOThreads.Write(this);
+		return;
+	}
+
 #ifndef DISABLE_WRITEV
 	if (GetIOHook())
 #endif
@@ -235,7 +464,7 @@ void StreamSocket::DoWrite()
 		{
 			while (error.empty() && !sendq.empty())
 			{
-				if (sendq.size() > 1 && sendq[0].length() < 1024)
+				if (sendq.size() > 1 && sendq.front()->GetData().length() - sendq_offset < 1024)
 				{
 					// Avoid multiple repeated SSL encryption invocations
 					// This adds a single copy of the queue, but avoids
@@ -246,17 +475,21 @@ void StreamSocket::DoWrite()
 					// more than once when writes begin to block.
 					std::string tmp;
 					tmp.reserve(1280);
+					tmp.append(sendq.front()->GetData(), sendq_offset, std::string::npos);
+					sendq.pop_front();
+					sendq_offset = 0;
 					while (!sendq.empty() && tmp.length() < 1024)
 					{
-						tmp.append(sendq.front());
+						tmp.append(sendq.front()->GetData());
 						sendq.pop_front();
 					}
-					sendq.push_front(tmp);
+					sendq.push_front(new SendBuffer(tmp));
 				}
-				std::string& front = sendq.front();
-				int itemlen = front.length();
 				if (GetIOHook())
 				{
+					// The IOHook may modify the buffer it is given, so it must not be shared with other sockets
+					std::string& front = UnshareSendQFront();
+					int itemlen = front.length();
 					rv = GetIOHook()->OnStreamSocketWrite(this, front);
 					if (rv > 0)
 					{
@@ -282,7 +515,9 @@ void StreamSocket::DoWrite()
 #ifdef DISABLE_WRITEV
 				else
 				{
-					rv = SocketEngine::Send(this, front.data(), itemlen, 0);
+					const std::string& front = sendq.front()->GetData();
+					int itemlen = front.length() - sendq_offset;
+					rv = SocketEngine::Send(this, front.data() + sendq_offset, itemlen, 0);
 					if (rv == 0)
 					{
 						SetError("Connection closed");
@@ -299,7 +534,7 @@ void StreamSocket::DoWrite()
 					else if (rv < itemlen)
 					{
 						SocketEngine::ChangeEventMask(this, FD_WANT_FAST_WRITE | FD_WRITE_WILL_BLOCK);
-						front = front.substr(rv);
+						sendq_offset += rv;
 						sendq_len -= rv;
 						return;
 					}
@@ -307,6 +542,7 @@ void StreamSocket::DoWrite()
 					{
 						sendq_len -= itemlen;
 						sendq.pop_front();
+						sendq_offset = 0;
 						if (sendq.empty())
 							SocketEngine::ChangeEventMask(this, FD_WANT_EDGE_WRITE);
 					}
@@ -328,8 +564,22 @@ void StreamSocket::DoWrite()
 			return;
 		// start out optimistic - we won't need to write any more
 		int eventChange = FD_WANT_EDGE_WRITE;
+
+		// Only send full packets while the sendq holds more than one writev() call worth
+		// of buffers, e.g. a server burst; stay corked until the sendq has drained
+		if (!corked && sendq.size() > (size_t)MYIOV_MAX && ServerInstance->Config->TCPCork)
+		{
+			SetCork(fd, 1);
+			corked = true;
+			ServerInstance->stats.Corked++;
+		}
+
 		while (error.empty() && sendq_len && eventChange == FD_WANT_EDGE_WRITE)
 		{
+			// Many small buffers; copy them together so each call sends more
+			if (sendq.size() > (size_t)MYIOV_MAX)
+				CoalesceSendQ();
+
 			// Prepare a writev() call to write all buffers efficiently
 			int bufcount = sendq.size();
 
@@ -340,26 +590,29 @@ void StreamSocket::DoWrite()
 			}
 
 			int rv_max = 0;
-			iovec* iovecs = new iovec[bufcount];
+			iovec iovecs[MYIOV_MAX];
 			for(int i=0; i < bufcount; i++)
 			{
-				iovecs[i].iov_base = const_cast<char*>(sendq[i].data());
-				iovecs[i].iov_len = sendq[i].length();
-				rv_max += sendq[i].length();
+				// The iovecs point directly at the (possibly shared) buffers, no copy is made
+				const std::string& data = sendq[i]->GetData();
+				const size_t offset = (i == 0 ? sendq_offset : 0);
+				iovecs[i].iov_base = const_cast<char*>(data.data() + offset);
+				iovecs[i].iov_len = data.length() - offset;
+				rv_max += iovecs[i].iov_len;
 			}
-			int rv = writev(fd, iovecs, bufcount);
-			delete[] iovecs;
+			int rv = SocketEngine::WriteV(this, iovecs, bufcount);
 
 			if (rv == (int)sendq_len)
 			{
 				// it's our lucky day, everything got written out. Fast cleanup.
 				// This won't ever happen if the number of buffers got capped.
 				sendq_len = 0;
+				sendq_offset = 0;
 				sendq.clear();
 			}
 			else if (rv > 0)
 			{
-				// Partial write. Clean out strings from the sendq
+				// Partial write. Clean out buffers from the sendq
 				if (rv < rv_max)
 				{
 					// it's going to block now
@@ -368,17 +621,18 @@ void StreamSocket::DoWrite()
 				sendq_len -= rv;
 				while (rv > 0 && !sendq.empty())
 				{
-					std::string& front = sendq.front();
-					if (front.length() <= (size_t)rv)
+					const size_t remaining = sendq.front()->GetData().length() - sendq_offset;
+					if (remaining <= (size_t)rv)
 					{
-						// this string got fully written out
-						rv -= front.length();
+						// this buffer got fully written out
+						rv -= remaining;
 						sendq.pop_front();
+						sendq_offset = 0;
 					}
 					else
 					{
-						// stopped in the middle of this string
-						front = front.substr(rv);
+						// stopped in the middle of this buffer
+						sendq_offset += rv;
 						rv = 0;
 					}
 				}
@@ -401,6 +655,11 @@ void StreamSocket::DoWrite()
 				error = SocketEngine::LastError();
 			}
 		}
+		if (corked && (!sendq_len || !error.empty()))
+		{
+			SetCork(fd, 0);
+			corked = false;
+		}
 		if (!error.empty())
 		{
 			// error - kill all events
@@ -423,9 +682,21 @@ void StreamSocket::WriteData(const std::string &data)
 		return;
 	}
 
+	WriteData(new SendBuffer(data));
+}
+
+void StreamSocket::WriteData(const reference<SendBuffer>& buffer)
+{
+	if (fd < 0)
+	{
+		ServerInstance->Logs->Log("SOCKET", LOG_DEBUG, "Attempt to write data to dead socket: %s",
+			buffer->GetData().c_str());
+		return;
+	}
+
 	/* Append the data to the back of the queue ready for writing */
-	sendq.push_back(data);
-	sendq_len += data.length();
+	sendq.push_back(buffer);
+	sendq_len += buffer->GetData().length();
 
 	SocketEngine::ChangeEventMask(this, FD_ADD_TRIAL_WRITE);
 }
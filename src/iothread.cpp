@@ -0,0 +1,988 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "inspircd.h"
+#include "iothread.h"
+
+#ifdef HAS_EPOLL
+
+#include <sys/epoll.h>
+#include <sys/uio.h>
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+namespace
+{
+	/** Maximum number of bytes queued to an I/O thread for a single connection before
+	 * writes are refused and the data stays in the sendq, where the connect class
+	 * sendq limits apply to it.
+	 */
+	const size_t MAX_BACKLOG = 65536;
+
+	/** Size of the buffer the I/O threads read into */
+	const size_t READ_BUFFER_SIZE = 65536;
+
+	/** Maximum number of events an I/O thread handles per epoll_wait() call */
+	const int MAX_EVENTS = 128;
+
+	/** Maximum number of buffers written with a single writev() call */
+	const int MAX_IOVECS = IOV_MAX < 128 ? IOV_MAX : 128;
+
+	/** Maximum number of bytes given to an IOHookTransport at once, this is the size of a TLS record */
+	const size_t TRANSPORT_CHUNK = 16384;
+}
+
+/** Buffers taken from the sendq of a socket. Only the main thread may change the reference
+ * counts of the buffers, so the I/O thread never frees a batch; it hands the batches it has
+ * written back to the main thread instead.
+ */
+struct IOThreadBatch
+{
+	/** The buffers, the I/O thread only reads their data */
+	std::deque<reference<SendBuffer> > buffers;
+
+	/** Number of bytes in the buffers which have to be written */
+	size_t length;
+
+	/** Index of the first buffer which has not been written completely. I/O thread only. */
+	size_t index;
+
+	/** Number of bytes of the first buffer which have been written */
+	size_t offset;
+
+	/** The next batch in the list this batch is in */
+	IOThreadBatch* next;
+
+	IOThreadBatch()
+		: length(0), index(0), offset(0), next(NULL)
+	{
+	}
+};
+
+/** A list of batches. Moving batches between lists does not touch the buffers in them,
+ * so this can be done by any thread; only the main thread may free them with clear().
+ */
+class IOThreadBatchList
+{
+	IOThreadBatch* head;
+	IOThreadBatch* tail;
+
+ public:
+	IOThreadBatchList()
+		: head(NULL), tail(NULL)
+	{
+	}
+
+	bool empty() const { return (head == NULL); }
+
+	IOThreadBatch* front() const { return head; }
+
+	void push_back(IOThreadBatch* batch)
+	{
+		batch->next = NULL;
+		if (tail)
+			tail->next = batch;
+		else
+			head = batch;
+		tail = batch;
+	}
+
+	IOThreadBatch* pop_front()
+	{
+		IOThreadBatch* batch = head;
+		head = batch->next;
+		if (!head)
+			tail = NULL;
+		batch->next = NULL;
+		return batch;
+	}
+
+	/** Move all batches of another list to the end of this one */
+	void splice(IOThreadBatchList& other)
+	{
+		if (other.empty())
+			return;
+		if (tail)
+			tail->next = other.head;
+		else
+			head = other.head;
+		tail = other.tail;
+		other.head = other.tail = NULL;
+	}
+
+	void swap(IOThreadBatchList& other)
+	{
+		std::swap(head, other.head);
+		std::swap(tail, other.tail);
+	}
+
+	/** Free all batches and the references to their buffers. Main thread only. */
+	void clear()
+	{
+		while (head)
+		{
+			IOThreadBatch* next = head->next;
+			delete head;
+			head = next;
+		}
+		tail = NULL;
+	}
+};
+
+/** A connection owned by an I/O thread. Created by the main thread when the socket is attached
+ * and deleted by the main thread when the I/O thread reports that the file descriptor is closed.
+ */
+struct IOThreadConnection
+{
+	/** The socket, or NULL if it has been closed. Main thread only. */
+	StreamSocket* sock;
+
+	/** Data received by the I/O thread but not yet read by the socket. Main thread only. */
+	std::string inbox;
+
+	/** The I/O thread that owns this connection */
+	IOThread* const thread;
+
+	/** The file descriptor, owned by the I/O thread */
+	const int fd;
+
+	/** Does the encryption of the connection, or NULL if it is plaintext. Used by the I/O thread,
+	 * but deleted by the main thread along with the connection.
+	 */
+	IOHookTransport* transport;
+
+	/** Number of bytes passed to the I/O thread which have not been written yet. Shared. */
+	size_t backlog;
+
+	/** True if the main thread refused a write because of the backlog and wants to be told
+	 * when it can write again. Shared.
+	 */
+	bool blocked;
+
+	/** Batches waiting to be written. I/O thread only. */
+	IOThreadBatchList outq;
+
+	/** Batches which have been written and are not handed back yet. I/O thread only. */
+	IOThreadBatchList written;
+
+	/** Data copied from the batches which the transport has not consumed yet. I/O thread only. */
+	std::string encodebuf;
+
+	/** Number of bytes of encodebuf which the transport has consumed. I/O thread only. */
+	size_t encodepos;
+
+	/** Received data that does not end in a newline yet. I/O thread only. */
+	std::string partial;
+
+	/** True if the thread's epoll instance is waiting for the socket to become writable. I/O thread only. */
+	bool wantwrite;
+
+	/** True if the transport can't read until the socket is writable. I/O thread only. */
+	bool readwantswrite;
+
+	/** True if the transport can't write until the socket is readable. I/O thread only. */
+	bool writewantsread;
+
+	/** True if the socket has failed and no more I/O is done on it. I/O thread only. */
+	bool dead;
+
+	IOThreadConnection(StreamSocket* s, IOThread* t, IOHookTransport* tr)
+		: sock(s), thread(t), fd(s->GetFd()), transport(tr), backlog(0), blocked(false), encodepos(0)
+		, wantwrite(false), readwantswrite(false), writewantsread(false), dead(false)
+	{
+	}
+
+	~IOThreadConnection()
+	{
+		delete transport;
+		outq.clear();
+		written.clear();
+	}
+
+	/** Check whether there is data left to write. I/O thread only. */
+	bool HasOutput() const
+	{
+		return (!outq.empty() || encodepos < encodebuf.length());
+	}
+};
+
+/** A message sent between the main thread and an I/O thread */
+struct IOThreadMessage
+{
+	enum Type
+	{
+		/** Main to I/O thread: start doing I/O on a connection */
+		MSG_ATTACH,
+		/** Main to I/O thread: write the batches */
+		MSG_WRITE,
+		/** Main to I/O thread: write what can be written, then close the file descriptor */
+		MSG_CLOSE,
+		/** Main to I/O thread: acknowledge that all earlier requests have been handled */
+		MSG_SYNC,
+		/** I/O thread to main: data has been received */
+		MSG_DATA,
+		/** I/O thread to main: the connection has failed, error holds the errno or 0 on EOF */
+		MSG_ERROR,
+		/** I/O thread to main: the backlog is below the limit again */
+		MSG_WRITABLE,
+		/** I/O thread to main: the batches have been written and can be freed */
+		MSG_RELEASE,
+		/** I/O thread to main: the file descriptor has been closed */
+		MSG_CLOSED
+	};
+
+	Type type;
+	IOThreadConnection* conn;
+	std::string data;
+	IOThreadBatchList batches;
+	int error;
+
+	IOThreadMessage()
+		: type(MSG_ATTACH), conn(NULL), error(0)
+	{
+	}
+
+	IOThreadMessage(Type t, IOThreadConnection* c, int err = 0)
+		: type(t), conn(c), error(err)
+	{
+	}
+
+	void swap(IOThreadMessage& other)
+	{
+		std::swap(type, other.type);
+		std::swap(conn, other.conn);
+		data.swap(other.data);
+		batches.swap(other.batches);
+		std::swap(error, other.error);
+	}
+};
+
+class IOThread : public SocketThread
+{
+	/** Requests from the main thread */
+	SPSCQueue<IOThreadMessage> requests;
+
+	/** Events for the main thread */
+	SPSCQueue<IOThreadMessage> events;
+
+	/** Pipe used by the main thread to wake the I/O thread up */
+	int wakefds[2];
+
+	/** The epoll instance the connections owned by this thread are registered with */
+	int epfd;
+
+	/** Buffer that data is received into. I/O thread only. */
+	std::vector<char> readbuf;
+
+	/** Connections which stopped reading before their transport ran out of data. I/O thread only. */
+	std::vector<IOThreadConnection*> pendingreads;
+
+	/** True if events were pushed since the main thread was last notified. I/O thread only. */
+	bool notify_pending;
+
+	/** True if requests were pushed since the I/O thread was last woken up. Main thread only. */
+	bool wakeup_pending;
+
+	/** Used by the main thread to wait for the I/O thread in Sync() */
+	ThreadQueueData syncdata;
+
+	/** True if the I/O thread has handled a sync request, protected by syncdata */
+	bool synced;
+
+	void Emit(IOThreadMessage& msg)
+	{
+		events.Push(msg);
+		notify_pending = true;
+	}
+
+	/** Register or update a connection in the epoll instance
+	 * @param conn The connection
+	 * @param op EPOLL_CTL_ADD or EPOLL_CTL_MOD
+	 */
+	void Watch(IOThreadConnection* conn, int op)
+	{
+		struct epoll_event ev;
+		memset(&ev, 0, sizeof(ev));
+		ev.events = EPOLLIN;
+		if (conn->wantwrite)
+			ev.events |= EPOLLOUT;
+		ev.data.ptr = static_cast<void*>(conn);
+		if (epoll_ctl(epfd, op, conn->fd, &ev) < 0)
+			Fail(conn, errno);
+	}
+
+	/** Wait for writability only while something can be written, or while the transport needs it to read */
+	void UpdateWatch(IOThreadConnection* conn)
+	{
+		if (conn->dead)
+			return;
+		const bool wantwrite = ((conn->HasOutput() && !conn->writewantsread) || conn->readwantswrite);
+		if (wantwrite != conn->wantwrite)
+		{
+			conn->wantwrite = wantwrite;
+			Watch(conn, EPOLL_CTL_MOD);
+		}
+	}
+
+	void Fail(IOThreadConnection* conn, int err)
+	{
+		if (conn->dead)
+			return;
+		conn->dead = true;
+		// Don't keep getting EPOLLHUP/EPOLLERR for a socket we no longer do I/O on
+		epoll_ctl(epfd, EPOLL_CTL_DEL, conn->fd, NULL);
+		IOThreadMessage msg(IOThreadMessage::MSG_ERROR, conn, err);
+		Emit(msg);
+	}
+
+	/** Pass all complete lines received on a connection to the main thread */
+	void Forward(IOThreadConnection* conn)
+	{
+		std::string::size_type eol = conn->partial.rfind('\n');
+		if (eol == std::string::npos && conn->partial.length() < READ_BUFFER_SIZE)
+			return;
+
+		IOThreadMessage msg(IOThreadMessage::MSG_DATA, conn);
+		if (eol == std::string::npos || eol + 1 == conn->partial.length())
+		{
+			msg.data.swap(conn->partial);
+		}
+		else
+		{
+			msg.data.assign(conn->partial, 0, eol + 1);
+			conn->partial.erase(0, eol + 1);
+		}
+		Emit(msg);
+	}
+
+	void DoRead(IOThreadConnection* conn)
+	{
+		// Read a bounded amount per wakeup so a single fast sender can't starve the others
+		unsigned int i = 0;
+		for (; i < 4; i++)
+		{
+			ssize_t n;
+			conn->readwantswrite = false;
+			if (conn->transport)
+				n = conn->transport->Read(&readbuf[0], readbuf.size(), conn->readwantswrite);
+			else
+				n = recv(conn->fd, &readbuf[0], readbuf.size(), 0);
+
+			if (n > 0)
+			{
+				conn->partial.append(&readbuf[0], n);
+				// A transport returns one record at a time, so only a short recv() means that the socket is drained
+				if (!conn->transport && static_cast<size_t>(n) < readbuf.size())
+					break;
+			}
+			else if (n == 0)
+			{
+				Forward(conn);
+				Fail(conn, 0);
+				return;
+			}
+			else if (errno == EINTR)
+			{
+				continue;
+			}
+			else if (errno == EAGAIN || errno == EWOULDBLOCK)
+			{
+				break;
+			}
+			else
+			{
+				int err = errno;
+				Forward(conn);
+				Fail(conn, err);
+				return;
+			}
+		}
+
+		// A transport may have read ahead and hold decoded data while the socket is drained,
+		// so epoll would not report it again; continue after the other connections had their turn
+		if (i == 4 && conn->transport)
+			pendingreads.push_back(conn);
+
+		Forward(conn);
+		UpdateWatch(conn);
+	}
+
+	/** Remove written data from the front of the batches to write, and move the batches
+	 * which have been written completely to the list of batches to hand back. Afterwards
+	 * the first batch to write, if any, has data left in its first buffer.
+	 */
+	static void Consume(IOThreadConnection* conn, size_t len)
+	{
+		while (!conn->outq.empty())
+		{
+			IOThreadBatch* batch = conn->outq.front();
+			if (batch->index == batch->buffers.size())
+			{
+				conn->written.push_back(conn->outq.pop_front());
+				continue;
+			}
+
+			const size_t left = batch->buffers[batch->index]->GetData().length() - batch->offset;
+			if (left > len)
+			{
+				batch->offset += len;
+				return;
+			}
+			len -= left;
+			batch->index++;
+			batch->offset = 0;
+		}
+	}
+
+	/** Write the batches straight from the buffers with writev() */
+	static ssize_t WriteSocket(IOThreadConnection* conn)
+	{
+		iovec iovecs[MAX_IOVECS];
+		int count = 0;
+		for (IOThreadBatch* batch = conn->outq.front(); batch && count < MAX_IOVECS; batch = batch->next)
+		{
+			for (size_t i = batch->index; i < batch->buffers.size() && count < MAX_IOVECS; i++)
+			{
+				const std::string& data = batch->buffers[i]->GetData();
+				const size_t offset = (i == batch->index ? batch->offset : 0);
+				iovecs[count].iov_base = const_cast<char*>(data.data() + offset);
+				iovecs[count].iov_len = data.length() - offset;
+				count++;
+			}
+		}
+
+		const ssize_t n = writev(conn->fd, iovecs, count);
+		if (n > 0)
+			Consume(conn, n);
+		return n;
+	}
+
+	/** Write through the transport. Small buffers are copied together first, so every line does
+	 * not become a record of its own; the copy is also what the transport retries a blocked write with.
+	 */
+	static ssize_t WriteTransport(IOThreadConnection* conn)
+	{
+		if (conn->encodepos == conn->encodebuf.length())
+		{
+			conn->encodebuf.clear();
+			conn->encodepos = 0;
+			while (!conn->outq.empty() && conn->encodebuf.length() < TRANSPORT_CHUNK)
+			{
+				IOThreadBatch* batch = conn->outq.front();
+				const std::string& data = batch->buffers[batch->index]->GetData();
+				const size_t len = std::min(data.length() - batch->offset, TRANSPORT_CHUNK - conn->encodebuf.length());
+				conn->encodebuf.append(data, batch->offset, len);
+				Consume(conn, len);
+			}
+		}
+
+		conn->writewantsread = false;
+		const ssize_t n = conn->transport->Write(conn->encodebuf.data() + conn->encodepos, conn->encodebuf.length() - conn->encodepos, conn->writewantsread);
+		if (n > 0)
+			conn->encodepos += n;
+		return n;
+	}
+
+	void DoWrite(IOThreadConnection* conn)
+	{
+		size_t written = 0;
+		Consume(conn, 0);
+		while (conn->HasOutput())
+		{
+			const ssize_t n = (conn->transport ? WriteTransport(conn) : WriteSocket(conn));
+			if (n > 0)
+			{
+				written += n;
+			}
+			else if (n < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+			{
+				break;
+			}
+			else
+			{
+				Fail(conn, n < 0 ? errno : 0);
+				break;
+			}
+		}
+
+		UpdateWatch(conn);
+		if (written)
+			Written(conn, written);
+		Release(conn);
+	}
+
+	/** Remove written (or discarded) data from the backlog, and tell the main thread if it was waiting for that */
+	void Written(IOThreadConnection* conn, size_t len)
+	{
+		size_t backlog = __atomic_sub_fetch(&conn->backlog, len, __ATOMIC_SEQ_CST);
+		if (backlog < MAX_BACKLOG && __atomic_exchange_n(&conn->blocked, false, __ATOMIC_SEQ_CST))
+		{
+			IOThreadMessage msg(IOThreadMessage::MSG_WRITABLE, conn);
+			Emit(msg);
+		}
+	}
+
+	/** Hand the written batches back to the main thread, which frees them */
+	void Release(IOThreadConnection* conn)
+	{
+		if (conn->written.empty())
+			return;
+		IOThreadMessage msg(IOThreadMessage::MSG_RELEASE, conn);
+		msg.batches.swap(conn->written);
+		Emit(msg);
+	}
+
+	void ProcessRequests()
+	{
+		IOThreadMessage msg;
+		while (requests.Pop(msg))
+		{
+			IOThreadConnection* const conn = msg.conn;
+			switch (msg.type)
+			{
+				case IOThreadMessage::MSG_ATTACH:
+					Watch(conn, EPOLL_CTL_ADD);
+					// The session may hold data it has already decoded, which epoll knows nothing about
+					if (conn->transport && !conn->dead)
+						DoRead(conn);
+					break;
+
+				case IOThreadMessage::MSG_WRITE:
+					if (conn->dead)
+					{
+						Written(conn, msg.batches.front()->length);
+						conn->written.splice(msg.batches);
+						Release(conn);
+						break;
+					}
+					conn->outq.splice(msg.batches);
+					DoWrite(conn);
+					break;
+
+				case IOThreadMessage::MSG_CLOSE:
+				{
+					// The main thread is done with this connection, send what we can and close it
+					if (!conn->dead)
+						DoWrite(conn);
+					if (conn->transport && !conn->dead)
+						conn->transport->Close();
+					// Closing the file descriptor also removes it from the epoll instance
+					stdalgo::erase(pendingreads, conn);
+					shutdown(conn->fd, 2);
+					close(conn->fd);
+
+					// The main thread frees the transport and the batches which were not written along with the connection
+					IOThreadMessage closed(IOThreadMessage::MSG_CLOSED, conn);
+					Emit(closed);
+					break;
+				}
+
+				case IOThreadMessage::MSG_SYNC:
+					syncdata.Lock();
+					synced = true;
+					syncdata.Wakeup();
+					syncdata.Unlock();
+					break;
+
+				default:
+					break;
+			}
+		}
+	}
+
+ public:
+	/** Number of connections attached to this thread. Main thread only. */
+	size_t connections;
+
+	IOThread()
+		: readbuf(READ_BUFFER_SIZE)
+		, notify_pending(false)
+		, wakeup_pending(false)
+		, synced(false)
+		, connections(0)
+	{
+		if (pipe(wakefds))
+			throw CoreException("Could not create pipe " + std::string(strerror(errno)));
+		SocketEngine::NonBlocking(wakefds[0]);
+		SocketEngine::NonBlocking(wakefds[1]);
+
+		epfd = epoll_create(MAX_EVENTS);
+		if (epfd < 0)
+		{
+			const std::string error = strerror(errno);
+			close(wakefds[0]);
+			close(wakefds[1]);
+			throw CoreException("Could not create epoll instance " + error);
+		}
+
+		// The wakeup pipe is the only entry with no connection
+		struct epoll_event ev;
+		memset(&ev, 0, sizeof(ev));
+		ev.events = EPOLLIN;
+		ev.data.ptr = NULL;
+		epoll_ctl(epfd, EPOLL_CTL_ADD, wakefds[0], &ev);
+	}
+
+	~IOThread()
+	{
+		close(epfd);
+		close(wakefds[0]);
+		close(wakefds[1]);
+
+		// Only connections which were closed but not acknowledged by the main thread can be left over
+		IOThreadMessage msg;
+		while (events.Pop(msg))
+		{
+			msg.batches.clear();
+			if (msg.type == IOThreadMessage::MSG_CLOSED)
+				delete msg.conn;
+		}
+	}
+
+	/** Queue a request for the I/O thread. Main thread only.
+	 * @param msg The request, its contents are moved into the queue
+	 */
+	void Post(IOThreadMessage& msg)
+	{
+		requests.Push(msg);
+		wakeup_pending = true;
+	}
+
+	/** Wake the I/O thread up if it has new requests. Main thread only. */
+	void Wakeup()
+	{
+		if (!wakeup_pending)
+			return;
+		wakeup_pending = false;
+		static const char dummy = '*';
+		if (write(wakefds[1], &dummy, 1) < 0 && errno != EAGAIN)
+			ServerInstance->Logs->Log("IOTHREAD", LOG_DEFAULT, "Unable to wake up I/O thread: %s", strerror(errno));
+	}
+
+	/** Wait until the I/O thread has handled all requests made so far, then handle
+	 * the events it has sent back. Main thread only.
+	 */
+	void Sync()
+	{
+		IOThreadMessage msg(IOThreadMessage::MSG_SYNC, NULL);
+		Post(msg);
+		Wakeup();
+
+		syncdata.Lock();
+		while (!synced)
+			syncdata.Wait();
+		synced = false;
+		syncdata.Unlock();
+
+		// Frees the connections closed before the sync, and with them their transports
+		OnNotify();
+	}
+
+	void SetExitFlag() CXX11_OVERRIDE
+	{
+		SocketThread::SetExitFlag();
+		wakeup_pending = true;
+		Wakeup();
+	}
+
+	void Run() CXX11_OVERRIDE
+	{
+		struct epoll_event ready[MAX_EVENTS];
+		while (!GetExitFlag())
+		{
+			const int count = epoll_wait(epfd, ready, MAX_EVENTS, pendingreads.empty() ? -1 : 0);
+			std::vector<IOThreadConnection*> pending;
+			pending.swap(pendingreads);
+
+			// Socket events first; requests can close connections
+			for (int i = 0; i < count; i++)
+			{
+				const unsigned int revents = ready[i].events;
+				IOThreadConnection* const conn = static_cast<IOThreadConnection*>(ready[i].data.ptr);
+				if (!conn)
+				{
+					char dummy[128];
+					while (read(wakefds[0], dummy, sizeof(dummy)) > 0);
+					continue;
+				}
+
+				if (conn->dead)
+					continue;
+				if ((revents & EPOLLOUT) || (conn->writewantsread && (revents & EPOLLIN)))
+					DoWrite(conn);
+				if (!conn->dead && ((revents & (EPOLLIN | EPOLLHUP | EPOLLERR)) || (conn->readwantswrite && (revents & EPOLLOUT))))
+					DoRead(conn);
+			}
+
+			for (std::vector<IOThreadConnection*>::const_iterator i = pending.begin(); i != pending.end(); ++i)
+			{
+				IOThreadConnection* const conn = *i;
+				// Connections which were read from above and still have data wait for the next round
+				if (!conn->dead && std::find(pendingreads.begin(), pendingreads.end(), conn) == pendingreads.end())
+					DoRead(conn);
+			}
+
+			ProcessRequests();
+
+			if (notify_pending)
+			{
+				notify_pending = false;
+				NotifyParent();
+			}
+		}
+
+		// Close the connections which were closed just before the thread was stopped
+		ProcessRequests();
+	}
+
+	void OnNotify() CXX11_OVERRIDE
+	{
+		IOThreadMessage msg;
+		while (events.Pop(msg))
+		{
+			IOThreadConnection* const conn = msg.conn;
+			if (msg.type == IOThreadMessage::MSG_CLOSED)
+			{
+				delete conn;
+				continue;
+			}
+
+			if (msg.type == IOThreadMessage::MSG_RELEASE)
+			{
+				msg.batches.clear();
+				continue;
+			}
+
+			// Events which were sent before the socket was closed
+			StreamSocket* const sock = conn->sock;
+			if (!sock)
+				continue;
+
+			switch (msg.type)
+			{
+				case IOThreadMessage::MSG_DATA:
+					SocketEngine::UpdateStats(msg.data.length(), 0);
+					if (conn->inbox.empty())
+						conn->inbox.swap(msg.data);
+					else
+						conn->inbox.append(msg.data);
+					sock->HandleEvent(EVENT_READ);
+					break;
+
+				case IOThreadMessage::MSG_ERROR:
+					sock->HandleEvent(EVENT_ERROR, msg.error);
+					break;
+
+				case IOThreadMessage::MSG_WRITABLE:
+					sock->HandleEvent(EVENT_WRITE);
+					break;
+
+				default:
+					break;
+			}
+		}
+	}
+};
+
+void IOThreadManager::Start(unsigned int count)
+{
+	for (unsigned int i = 0; i < count; i++)
+	{
+		IOThread* thread = new IOThread;
+		ServerInstance->Threads.Start(thread);
+		threads.push_back(thread);
+	}
+	if (count)
+		ServerInstance->Logs->Log("IOTHREAD", LOG_DEFAULT, "Started %u I/O threads", count);
+}
+
+void IOThreadManager::Stop()
+{
+	for (std::vector<IOThread*>::iterator i = threads.begin(); i != threads.end(); ++i)
+	{
+		IOThread* thread = *i;
+		thread->join();
+		delete thread;
+	}
+	threads.clear();
+}
+
+void IOThreadManager::Flush()
+{
+	for (std::vector<IOThread*>::iterator i = threads.begin(); i != threads.end(); ++i)
+		(*i)->Wakeup();
+}
+
+void IOThreadManager::Sync()
+{
+	for (std::vector<IOThread*>::iterator i = threads.begin(); i != threads.end(); ++i)
+		(*i)->Sync();
+}
+
+bool IOThreadManager::Attach(StreamSocket* sock)
+{
+	if (threads.empty() || sock->threadconn)
+		return false;
+
+#ifdef SOCKETENGINE_OWNS_IO
+	// The socket engine submits the I/O of plaintext sockets itself and may hold data for them
+	if (!sock->GetIOHook())
+		return false;
+#endif
+
+	IOHookTransport* transport = NULL;
+	if (sock->GetIOHook())
+	{
+		transport = sock->GetIOHook()->DetachTransport(sock);
+		if (!transport)
+			return false;
+	}
+
+	IOThread* thread = threads[0];
+	for (std::vector<IOThread*>::const_iterator i = threads.begin()+1; i != threads.end(); ++i)
+	{
+		if ((*i)->connections < thread->connections)
+			thread = *i;
+	}
+
+	// The I/O thread waits for events on the socket from now on; the main socket engine only keeps
+	// the reference to it so that trial writes still flush the sendq to the I/O thread
+	SocketEngine::DetachFd(sock);
+
+	IOThreadConnection* conn = new IOThreadConnection(sock, thread, transport);
+	sock->threadconn = conn;
+	thread->connections++;
+	IOThreadMessage msg(IOThreadMessage::MSG_ATTACH, conn);
+	thread->Post(msg);
+	return true;
+}
+
+bool IOThreadManager::Read(StreamSocket* sock)
+{
+	IOThreadConnection* const conn = sock->threadconn;
+	if (conn->inbox.empty())
+		return false;
+	sock->recvq.append(conn->inbox.data(), conn->inbox.length());
+	conn->inbox.clear();
+	return true;
+}
+
+void IOThreadManager::Write(StreamSocket* sock)
+{
+	IOThreadConnection* const conn = sock->threadconn;
+	if (sock->sendq.empty())
+		return;
+
+	size_t backlog = __atomic_load_n(&conn->backlog, __ATOMIC_SEQ_CST);
+	if (backlog >= MAX_BACKLOG)
+	{
+		// Set the flag before checking again so the I/O thread can't miss it
+		__atomic_store_n(&conn->blocked, true, __ATOMIC_SEQ_CST);
+		backlog = __atomic_load_n(&conn->backlog, __ATOMIC_SEQ_CST);
+		if (backlog >= MAX_BACKLOG)
+			return;
+	}
+
+	IOThreadBatch* batch = new IOThreadBatch;
+	batch->offset = sock->sendq_offset;
+	if (backlog + sock->sendq_len <= MAX_BACKLOG)
+	{
+		batch->buffers.swap(sock->sendq);
+		batch->length = sock->sendq_len;
+	}
+	else
+	{
+		// Only pass what fits, the rest stays in the sendq where the sendq limits apply to it
+		while (!sock->sendq.empty() && backlog + batch->length < MAX_BACKLOG)
+		{
+			batch->length += sock->sendq.front()->GetData().length() - (batch->buffers.empty() ? batch->offset : 0);
+			batch->buffers.push_back(sock->sendq.front());
+			sock->sendq.pop_front();
+		}
+
+		// Nothing else makes us try again, so have the I/O thread tell us when it has written this
+		if (!sock->sendq.empty())
+			__atomic_store_n(&conn->blocked, true, __ATOMIC_SEQ_CST);
+	}
+	sock->sendq_len -= batch->length;
+	sock->sendq_offset = 0;
+
+	SocketEngine::UpdateStats(0, batch->length);
+	__atomic_add_fetch(&conn->backlog, batch->length, __ATOMIC_SEQ_CST);
+	IOThreadMessage msg(IOThreadMessage::MSG_WRITE, conn);
+	msg.batches.push_back(batch);
+	conn->thread->Post(msg);
+}
+
+void IOThreadManager::Detach(StreamSocket* sock)
+{
+	IOThreadConnection* const conn = sock->threadconn;
+	SocketEngine::DelDetachedFd(sock);
+	sock->SetFd(-1);
+	sock->threadconn = NULL;
+
+	conn->sock = NULL;
+	conn->thread->connections--;
+	IOThreadMessage msg(IOThreadMessage::MSG_CLOSE, conn);
+	conn->thread->Post(msg);
+}
+
+#else
+
+void IOThreadManager::Start(unsigned int count)
+{
+	if (count)
+		ServerInstance->Logs->Log("IOTHREAD", LOG_DEFAULT, "I/O threads are not supported on this platform");
+}
+
+void IOThreadManager::Stop()
+{
+}
+
+void IOThreadManager::Flush()
+{
+}
+
+void IOThreadManager::Sync()
+{
+}
+
+bool IOThreadManager::Attach(StreamSocket* sock)
+{
+	return false;
+}
+
+bool IOThreadManager::Read(StreamSocket* sock)
+{
+	return false;
+}
+
+void IOThreadManager::Write(StreamSocket* sock)
+{
+}
+
+void IOThreadManager::Detach(StreamSocket* sock)
+{
+}
+
+#endif
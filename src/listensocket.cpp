@@ -24,9 +24,12 @@
 #include <netinet/tcp.h>
 #endif
 
-ListenSocket::ListenSocket(ConfigTag* tag, const irc::sockets::sockaddrs& bind_to)
+ListenSocket::ListenSocket(ConfigTag* tag, const irc::sockets::sockaddrs& bind_to, bool reuseport)
 	: bind_tag(tag)
 	, iohookprov(NULL, std::string())
+	, accepted(0)
+	, rejected(0)
+	, drained(0)
 {
 	irc::sockets::satoap(bind_to, bind_addr, bind_port);
 	bind_desc = bind_to.str();
@@ -55,6 +58,13 @@ ListenSocket::ListenSocket(ConfigTag* tag, const irc::sockets::sockaddrs& bind_t
 #endif
 
 	SocketEngine::SetReuse(fd);
+#ifdef SO_REUSEPORT
+	if (reuseport)
+	{
+		const int enable = 1;
+		setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char*>(&enable), sizeof(enable));
+	}
+#endif
 	int rv = SocketEngine::Bind(this->fd, bind_to);
 	if (rv >= 0)
 		rv = SocketEngine::Listen(this->fd, ServerInstance->Config->MaxConn);
@@ -100,8 +110,7 @@ ListenSocket::~ListenSocket()
 	}
 }
 
-/* Just seperated into another func for tidiness really.. */
-void ListenSocket::AcceptInternal()
+bool ListenSocket::AcceptInternal()
 {
 	irc::sockets::sockaddrs client;
 	irc::sockets::sockaddrs server;
@@ -112,8 +121,21 @@ void ListenSocket::AcceptInternal()
 	ServerInstance->Logs->Log("SOCKET", LOG_DEBUG, "HandleEvent for Listensocket %s nfd=%d", bind_desc.c_str(), incomingSockfd);
 	if (incomingSockfd < 0)
 	{
+		if (SocketEngine::IgnoreError())
+		{
+			// Nothing left in the accept queue
+			drained++;
+			return false;
+		}
+
+		// The client went away before we got to it, others may still be waiting
+		if (errno == ECONNABORTED || errno == EINTR)
+			return true;
+
+		ServerInstance->Logs->Log("SOCKET", LOG_DEBUG, "Can't accept connection on %s: %s", bind_desc.c_str(), strerror(errno));
 		ServerInstance->stats.Refused++;
-		return;
+		rejected++;
+		return false;
 	}
 
 	socklen_t sz = sizeof(server);
@@ -153,7 +175,9 @@ void ListenSocket::AcceptInternal()
 		}
 	}
 
+#ifndef HAS_ACCEPT4
 	SocketEngine::NonBlocking(incomingSockfd);
+#endif
 
 	ModResult res;
 	FIRST_MOD_RESULT(OnAcceptConnection, res, (incomingSockfd, this, &client, &server));
@@ -169,14 +193,17 @@ void ListenSocket::AcceptInternal()
 	if (res == MOD_RES_ALLOW)
 	{
 		ServerInstance->stats.Accept++;
+		accepted++;
 	}
 	else
 	{
 		ServerInstance->stats.Refused++;
+		rejected++;
 		ServerInstance->Logs->Log("SOCKET", LOG_DEFAULT, "Refusing connection on %s - %s",
 			bind_desc.c_str(), res == MOD_RES_DENY ? "Connection refused by module" : "Module for this port not found");
 		SocketEngine::Close(incomingSockfd);
 	}
+	return true;
 }
 
 void ListenSocket::HandleEvent(EventType e, int err)
@@ -190,8 +217,15 @@ void ListenSocket::HandleEvent(EventType e, int err)
 			ServerInstance->Logs->Log("SOCKET", LOG_DEBUG, "*** BUG *** ListenSocket::HandleEvent() got a WRITE event!!!");
 			break;
 		case EVENT_READ:
-			this->AcceptInternal();
+		{
+			// Drain the accept queue, but give other sockets a chance if it is very long
+			for (unsigned int i = 0; i < ServerInstance->Config->AcceptBatch; i++)
+			{
+				if (!this->AcceptInternal())
+					break;
+			}
 			break;
+		}
 	}
 }
 
@@ -19,6 +19,140 @@
 #include "inspircd.h"
 #include "listmode.h"
 
+/** Fold a host with the ASCII case map, hosts in the index only contain characters which every case map folds the same way
+ * @param host The host to fold
+ * @return The folded host, valid until the next call
+ */
+static const std::string& FoldHost(const std::string& host)
+{
+	static std::string folded;
+	folded.resize(host.length());
+	for (std::string::size_type i = 0; i < host.length(); ++i)
+		folded[i] = ascii_case_insensitive_map[(unsigned char)host[i]];
+	return folded;
+}
+
+/** Get the host part of a list item which can be looked up in the hash
+ * @param mask The mask of the list item
+ * @return The position of the host in the mask, or std::string::npos if the item is not a nick!ident\@host mask with a plain host
+ */
+static std::string::size_type GetIndexHost(const std::string& mask)
+{
+	// Channel::CheckBan() matches the part after the first '@' against the host
+	std::string::size_type at = mask.find('@');
+	if ((at == std::string::npos) || (at + 1 == mask.length()) || (mask.length() <= 2) || (mask[1] == ':'))
+		return std::string::npos;
+
+	for (std::string::size_type i = at + 1; i < mask.length(); ++i)
+	{
+		const unsigned char chr = mask[i];
+		if (((chr < 'a') || (chr > 'z')) && ((chr < 'A') || (chr > 'Z')) && ((chr < '0') || (chr > '9')) && (!strchr(".-:_/", chr)))
+			return std::string::npos;
+	}
+	return at + 1;
+}
+
+void ListModeBase::MaskIndex::Add(const ListItem& item, size_t pos)
+{
+	const std::string& mask = item.mask;
+	if ((mask.length() > 2) && (mask[1] == ':'))
+	{
+		extbans[mask[0]].push_back(pos);
+		return;
+	}
+
+	const std::string::size_type host = GetIndexHost(mask);
+	if (host == std::string::npos)
+	{
+		others.push_back(pos);
+		return;
+	}
+
+	hosts.insert(std::make_pair(FoldHost(mask.substr(host)), pos));
+	if (item.cidr.type != AF_UNSPEC)
+		addresses.insert(item.cidr, pos);
+}
+
+void ListModeBase::MaskIndex::Remove(const ListItem& item, size_t pos)
+{
+	const std::string& mask = item.mask;
+	if ((mask.length() > 2) && (mask[1] == ':'))
+	{
+		std::vector<size_t>& list = extbans[mask[0]];
+		stdalgo::vector::swaperase(list, pos);
+		if (list.empty())
+			extbans.erase(mask[0]);
+		return;
+	}
+
+	const std::string::size_type host = GetIndexHost(mask);
+	if (host == std::string::npos)
+	{
+		stdalgo::vector::swaperase(others, pos);
+		return;
+	}
+
+	std::pair<HostMap::iterator, HostMap::iterator> range = hosts.equal_range(FoldHost(mask.substr(host)));
+	for (HostMap::iterator i = range.first; i != range.second; ++i)
+	{
+		if (i->second == pos)
+		{
+			hosts.erase(i);
+			break;
+		}
+	}
+
+	if (item.cidr.type != AF_UNSPEC)
+		addresses.erase(item.cidr, pos);
+}
+
+void ListModeBase::MaskIndex::FindHost(const std::string& host, const ModeList& list, std::vector<const ListItem*>& out) const
+{
+	std::pair<HostMap::const_iterator, HostMap::const_iterator> range = hosts.equal_range(FoldHost(host));
+	for (HostMap::const_iterator i = range.first; i != range.second; ++i)
+		out.push_back(&list[i->second]);
+}
+
+void ListModeBase::MaskIndex::Find(User* user, const ModeList& list, std::vector<const ListItem*>& out) const
+{
+	for (std::vector<size_t>::const_iterator i = others.begin(); i != others.end(); ++i)
+		out.push_back(&list[*i]);
+
+	for (insp::flat_map<char, std::vector<size_t> >::const_iterator i = extbans.begin(); i != extbans.end(); ++i)
+		for (std::vector<size_t>::const_iterator j = i->second.begin(); j != i->second.end(); ++j)
+			out.push_back(&list[*j]);
+
+	if (hosts.empty())
+		return;
+
+	FindHost(user->host, list, out);
+	if (user->dhost != user->host)
+		FindHost(user->dhost, list, out);
+	const std::string& ip = user->GetIPString();
+	if (ip != user->host)
+		FindHost(ip, list, out);
+
+	std::vector<std::string> banhosts;
+	FOREACH_MOD(OnBuildBanHostList, (user, banhosts));
+	for (std::vector<std::string>::const_iterator i = banhosts.begin(); i != banhosts.end(); ++i)
+		FindHost(*i, list, out);
+
+	std::vector<size_t> found;
+	addresses.find(user->client_sa, found);
+	for (std::vector<size_t>::const_iterator i = found.begin(); i != found.end(); ++i)
+		out.push_back(&list[*i]);
+}
+
+void ListModeBase::MaskIndex::FindExtBans(char type, const ModeList& list, std::vector<const ListItem*>& out) const
+{
+	insp::flat_map<char, std::vector<size_t> >::const_iterator it = extbans.find(type);
+	if (it == extbans.end())
+		return;
+
+	for (std::vector<size_t>::const_iterator i = it->second.begin(); i != it->second.end(); ++i)
+		out.push_back(&list[*i]);
+}
+
 ListModeBase::ListModeBase(Module* Creator, const std::string& Name, char modechar, const std::string &eolstr, unsigned int lnum, unsigned int eolnum, bool autotidy, const std::string &ctag)
 	: ModeHandler(Creator, Name, modechar, PARAM_ALWAYS, MODETYPE_CHANNEL, MC_LIST),
 	listnumeric(lnum), endoflistnumeric(eolnum), endofliststring(eolstr), tidy(autotidy),
@@ -175,6 +309,8 @@ ModeAction ListModeBase::OnModeChange(User* source, User*, Channel* channel, std
 		{
 			// And now add the mask onto the list...
 			cd->list.push_back(ListItem(parameter, source->nick, ServerInstance->Time()));
+			cd->index.Add(cd->list.back(), cd->list.size() - 1);
+			channel->bangeneration++;
 			return MODEACTION_ALLOW;
 		}
 		else
@@ -192,7 +328,17 @@ ModeAction ListModeBase::OnModeChange(User* source, User*, Channel* channel, std
 			{
 				if (parameter == it->mask)
 				{
+					// The last item is moved to the place of the removed one
+					const size_t pos = it - cd->list.begin();
+					const size_t last = cd->list.size() - 1;
+					cd->index.Remove(*it, pos);
+					if (pos != last)
+					{
+						cd->index.Remove(cd->list.back(), last);
+						cd->index.Add(cd->list.back(), pos);
+					}
 					stdalgo::vector::swaperase(cd->list, it);
+					channel->bangeneration++;
 					return MODEACTION_ALLOW;
 				}
 			}
@@ -204,6 +350,20 @@ ModeAction ListModeBase::OnModeChange(User* source, User*, Channel* channel, std
 	}
 }
 
+void ListModeBase::FindItems(Channel* channel, User* user, std::vector<const ListItem*>& out)
+{
+	ChanData* cd = extItem.get(channel);
+	if (cd)
+		cd->index.Find(user, cd->list, out);
+}
+
+void ListModeBase::FindExtBans(Channel* channel, char type, std::vector<const ListItem*>& out)
+{
+	ChanData* cd = extItem.get(channel);
+	if (cd)
+		cd->index.FindExtBans(type, cd->list, out);
+}
+
 bool ListModeBase::ValidateParam(User*, Channel*, std::string&)
 {
 	return true;
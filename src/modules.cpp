@@ -61,7 +61,7 @@ void Event::Send()
 
 // These declarations define the behavours of the base class Module (which does nothing at all)
 
-Module::Module() { }
+Module::Module() : cacheablebanchecks(false) { }
 CullResult Module::cull()
 {
 	return classbase::cull();
@@ -114,6 +114,7 @@ ModResult	Module::OnCheckKey(User*, Channel*, const std::string&) { DetachEvent(
 ModResult	Module::OnCheckLimit(User*, Channel*) { DetachEvent(I_OnCheckLimit); return MOD_RES_PASSTHRU; }
 ModResult	Module::OnCheckChannelBan(User*, Channel*) { DetachEvent(I_OnCheckChannelBan); return MOD_RES_PASSTHRU; }
 ModResult	Module::OnCheckBan(User*, Channel*, const std::string&) { DetachEvent(I_OnCheckBan); return MOD_RES_PASSTHRU; }
+void		Module::OnBuildBanHostList(User*, std::vector<std::string>&) { DetachEvent(I_OnBuildBanHostList); }
 ModResult	Module::OnExtBanCheck(User*, Channel*, char) { DetachEvent(I_OnExtBanCheck); return MOD_RES_PASSTHRU; }
 ModResult	Module::OnStats(char, User*, string_list&) { DetachEvent(I_OnStats); return MOD_RES_PASSTHRU; }
 ModResult	Module::OnChangeLocalUserHost(LocalUser*, const std::string&) { DetachEvent(I_OnChangeLocalUserHost); return MOD_RES_PASSTHRU; }
@@ -140,7 +141,7 @@ ModResult	Module::OnChannelPreDelete(Channel*) { DetachEvent(I_OnChannelPreDelet
 void		Module::OnChannelDelete(Channel*) { DetachEvent(I_OnChannelDelete); }
 ModResult	Module::OnSetAway(User*, const std::string &) { DetachEvent(I_OnSetAway); return MOD_RES_PASSTHRU; }
 ModResult	Module::OnWhoisLine(User*, User*, int&, std::string&) { DetachEvent(I_OnWhoisLine); return MOD_RES_PASSTHRU; }
-void		Module::OnBuildNeighborList(User*, IncludeChanList&, std::map<User*,bool>&) { DetachEvent(I_OnBuildNeighborList); }
+void		Module::OnBuildNeighborList(User*, IncludeChanList&, NeighborExceptions&) { DetachEvent(I_OnBuildNeighborList); }
 void		Module::OnGarbageCollect() { DetachEvent(I_OnGarbageCollect); }
 ModResult	Module::OnSetConnectClass(LocalUser* user, ConnectClass* myclass) { DetachEvent(I_OnSetConnectClass); return MOD_RES_PASSTHRU; }
 void 		Module::OnText(User*, void*, int, const std::string&, char, CUList&) { DetachEvent(I_OnText); }
@@ -181,12 +182,46 @@ bool ModuleManager::Attach(Implementation i, Module* mod)
 		return false;
 
 	EventHandlers[i].push_back(mod);
+	if (IsBanCheckEvent(i))
+		InvalidateBanChecks();
 	return true;
 }
 
 bool ModuleManager::Detach(Implementation i, Module* mod)
 {
-	return stdalgo::erase(EventHandlers[i], mod);
+	if (!stdalgo::erase(EventHandlers[i], mod))
+		return false;
+
+	if (IsBanCheckEvent(i))
+		InvalidateBanChecks();
+	return true;
+}
+
+bool ModuleManager::IsBanCheckEvent(Implementation i)
+{
+	return ((i == I_OnCheckBan) || (i == I_OnCheckChannelBan) || (i == I_OnBuildBanHostList));
+}
+
+void ModuleManager::InvalidateBanChecks()
+{
+	const chan_hash& chans = ServerInstance->GetChans();
+	for (chan_hash::const_iterator i = chans.begin(); i != chans.end(); ++i)
+		i->second->bangeneration++;
+}
+
+bool ModuleManager::AreBanChecksCacheable() const
+{
+	static const Implementation events[] = { I_OnCheckBan, I_OnCheckChannelBan, I_OnBuildBanHostList };
+	for (size_t n = 0; n < sizeof(events) / sizeof(events[0]); ++n)
+	{
+		const IntModuleList& handlers = EventHandlers[events[n]];
+		for (IntModuleList::const_iterator i = handlers.begin(); i != handlers.end(); ++i)
+		{
+			if (!(*i)->cacheablebanchecks)
+				return false;
+		}
+	}
+	return true;
 }
 
 void ModuleManager::Attach(Implementation* i, Module* mod, size_t sz)
@@ -392,6 +427,11 @@ void ModuleManager::DoSafeUnload(Module* mod)
 		++u;
 		mod->OnCleanup(TYPE_USER, user);
 		user->doUnhookExtensions(items);
+
+		// The module may have been holding this user back from registering
+		LocalUser* localuser = IS_LOCAL(user);
+		if (localuser)
+			localuser->CheckReady();
 	}
 
 	const ModeParser::ModeHandlerMap& usermodes = ServerInstance->Modes->GetModes(MODETYPE_USER);
@@ -464,6 +504,8 @@ namespace
 			DLLManager* dll = mod->ModuleDLLManager;
 			ServerInstance->Modules->DoSafeUnload(mod);
 			ServerInstance->GlobalCulls.Apply();
+			// The I/O threads may still be closing sockets with transports of this module
+			ServerInstance->IOThreads.Sync();
 			// In pure static mode this is always NULL
 			delete dll;
 			ServerInstance->GlobalCulls.AddItem(this);
@@ -482,6 +524,8 @@ namespace
 			std::string name = mod->ModuleSourceFile;
 			ServerInstance->Modules->DoSafeUnload(mod);
 			ServerInstance->GlobalCulls.Apply();
+			// The I/O threads may still be closing sockets with transports of this module
+			ServerInstance->IOThreads.Sync();
 			delete dll;
 			bool rv = ServerInstance->Modules->Load(name);
 			if (callback)
@@ -554,6 +598,8 @@ void ModuleManager::LoadAll()
 
 	if (!PrioritizeHooks())
 		ServerInstance->Exit(EXIT_STATUS_MODULE);
+
+	ServerInstance->Parser.BuildCommandTable();
 }
 
 std::string& ModuleManager::LastError()
@@ -546,6 +546,85 @@ namespace GnuTLS
 	};
 }
 
+/** Does the I/O of a session which has been moved to an I/O thread */
+class GnuTLSTransport : public IOHookTransport
+{
+	const gnutls_session_t sess;
+	const int fd;
+
+	/** Keeps the credentials used by the session alive */
+	reference<GnuTLS::Profile> profile;
+
+	static ssize_t Pull(gnutls_transport_ptr_t ptr, void* buffer, size_t size)
+	{
+		GnuTLSTransport* transport = reinterpret_cast<GnuTLSTransport*>(ptr);
+		return recv(transport->fd, reinterpret_cast<char*>(buffer), size, 0);
+	}
+
+	static ssize_t Push(gnutls_transport_ptr_t ptr, const void* buffer, size_t size)
+	{
+		GnuTLSTransport* transport = reinterpret_cast<GnuTLSTransport*>(ptr);
+		return send(transport->fd, reinterpret_cast<const char*>(buffer), size, 0);
+	}
+
+	/** Map an error of gnutls_record_recv() or gnutls_record_send() to errno
+	 * @param ret The error
+	 * @param wantother Set to true if the operation can't continue until the socket is ready for the other direction
+	 * @param otherdir The direction returned by gnutls_record_get_direction() for the other direction
+	 * @return Always -1
+	 */
+	ssize_t Error(int ret, bool& wantother, int otherdir)
+	{
+		if ((ret == GNUTLS_E_AGAIN) || (ret == GNUTLS_E_INTERRUPTED))
+		{
+			wantother = (gnutls_record_get_direction(sess) == otherdir);
+			errno = EAGAIN;
+		}
+		else
+		{
+			errno = EIO;
+		}
+		return -1;
+	}
+
+ public:
+	GnuTLSTransport(gnutls_session_t session, int sockfd, const reference<GnuTLS::Profile>& sslprofile)
+		: sess(session)
+		, fd(sockfd)
+		, profile(sslprofile)
+	{
+		gnutls_transport_set_ptr(sess, reinterpret_cast<gnutls_transport_ptr_t>(this));
+		gnutls_transport_set_push_function(sess, Push);
+		gnutls_transport_set_pull_function(sess, Pull);
+	}
+
+	~GnuTLSTransport()
+	{
+		gnutls_deinit(sess);
+	}
+
+	ssize_t Read(char* buffer, size_t size, bool& wantwrite) CXX11_OVERRIDE
+	{
+		ssize_t ret = gnutls_record_recv(sess, buffer, size);
+		if (ret >= 0)
+			return ret;
+		return Error(ret, wantwrite, 1);
+	}
+
+	ssize_t Write(const char* buffer, size_t size, bool& wantread) CXX11_OVERRIDE
+	{
+		ssize_t ret = gnutls_record_send(sess, buffer, size);
+		if (ret > 0)
+			return ret;
+		return Error(ret, wantread, 0);
+	}
+
+	void Close() CXX11_OVERRIDE
+	{
+		gnutls_bye(sess, GNUTLS_SHUT_WR);
+	}
+};
+
 class GnuTLSIOHook : public SSLIOHook
 {
  private:
@@ -553,6 +632,12 @@ class GnuTLSIOHook : public SSLIOHook
 	issl_status status;
 	reference<GnuTLS::Profile> profile;
 
+	/** True if gnutls_record_send() has to be called again with the same data */
+	bool data_to_write;
+
+	/** Description of the cipher suite in use, known once the handshake is done */
+	std::string cipher;
+
 	void InitSession(StreamSocket* user, bool me_server)
 	{
 		gnutls_init(&sess, me_server ? GNUTLS_SERVER : GNUTLS_CLIENT);
@@ -617,6 +702,10 @@ class GnuTLSIOHook : public SSLIOHook
 
 			VerifyCertificate();
 
+			cipher = UnknownIfNULL(gnutls_kx_get_name(gnutls_kx_get(sess)));
+			cipher.append("-").append(UnknownIfNULL(gnutls_cipher_get_name(gnutls_cipher_get(sess)))).append("-");
+			cipher.append(UnknownIfNULL(gnutls_mac_get_name(gnutls_mac_get(sess))));
+
 			// Finish writing, if any left
 			SocketEngine::ChangeEventMask(user, FD_WANT_POLL_READ | FD_WANT_NO_WRITE | FD_ADD_TRIAL_WRITE);
 
@@ -811,6 +900,7 @@ info_done_dealloc:
 		, sess(NULL)
 		, status(ISSL_NONE)
 		, profile(sslprofile)
+		, data_to_write(false)
 	{
 		InitSession(sock, outbound);
 		sock->AddIOHook(this);
@@ -822,7 +912,7 @@ info_done_dealloc:
 		CloseSession();
 	}
 
-	int OnStreamSocketRead(StreamSocket* user, std::string& recvq) CXX11_OVERRIDE
+	int OnStreamSocketRead(StreamSocket* user, RecvQueue& recvq) CXX11_OVERRIDE
 	{
 		if (!this->sess)
 		{
@@ -847,12 +937,11 @@ info_done_dealloc:
 
 		if (this->status == ISSL_HANDSHAKEN)
 		{
-			char* buffer = ServerInstance->GetReadBuffer();
 			size_t bufsiz = ServerInstance->Config->NetBufferSize;
-			int ret = gnutls_record_recv(this->sess, buffer, bufsiz);
+			int ret = gnutls_record_recv(this->sess, recvq.GetWriteBuffer(bufsiz), bufsiz);
 			if (ret > 0)
 			{
-				recvq.append(buffer, ret);
+				recvq.Commit(ret);
 				return 1;
 			}
 			else if (ret == GNUTLS_E_AGAIN || ret == GNUTLS_E_INTERRUPTED)
@@ -901,6 +990,7 @@ info_done_dealloc:
 		if (this->status == ISSL_HANDSHAKEN)
 		{
 			ret = gnutls_record_send(this->sess, sendq.data(), sendq.length());
+			data_to_write = (ret <= 0);
 
 			if (ret == (int)sendq.length())
 			{
@@ -929,15 +1019,22 @@ info_done_dealloc:
 		return 0;
 	}
 
+	IOHookTransport* DetachTransport(StreamSocket* sock) CXX11_OVERRIDE
+	{
+		// A write which has to be retried with the same data can't be handed over
+		if ((!sess) || (status != ISSL_HANDSHAKEN) || (data_to_write))
+			return NULL;
+
+		GnuTLSTransport* transport = new GnuTLSTransport(sess, sock->GetFd(), profile);
+		sess = NULL;
+		return transport;
+	}
+
 	void TellCiphersAndFingerprint(LocalUser* user)
 	{
-		if (sess)
+		if (certificate)
 		{
-			std::string text = "*** You are connected using SSL cipher '";
-
-			text += UnknownIfNULL(gnutls_kx_get_name(gnutls_kx_get(sess)));
-			text.append("-").append(UnknownIfNULL(gnutls_cipher_get_name(gnutls_cipher_get(sess)))).append("-");
-			text.append(UnknownIfNULL(gnutls_mac_get_name(gnutls_mac_get(sess)))).append("'");
+			std::string text = "*** You are connected using SSL cipher '" + cipher + "'";
 
 			if (!certificate->fingerprint.empty())
 				text += " and your SSL certificate fingerprint is " + certificate->fingerprint;
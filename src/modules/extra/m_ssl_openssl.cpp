@@ -345,6 +345,106 @@ static int OnVerify(int preverify_ok, X509_STORE_CTX *ctx)
 	return 1;
 }
 
+/** Does the I/O of a session which has been moved to an I/O thread */
+class OpenSSLTransport : public IOHookTransport
+{
+	SSL* const sess;
+
+#ifdef INSPIRCD_OPENSSL_ENABLE_RENEGO_DETECTION
+	/** True if renegotiations are allowed, copied from the profile */
+	const bool allowrenego;
+
+	/** True if the other side has tried to renegotiate when it is not allowed to */
+	bool renegotiated;
+#endif
+
+	/** Map an error of SSL_read() or SSL_write() to errno
+	 * @param ret Return value of SSL_read() or SSL_write()
+	 * @param wantother Set to true if the operation can't continue until the socket is ready for the other direction
+	 * @param other The error code meaning that the other direction is wanted
+	 * @return Always -1
+	 */
+	ssize_t Error(int ret, bool& wantother, int other)
+	{
+		const int err = SSL_get_error(sess, ret);
+		if ((err == SSL_ERROR_WANT_READ) || (err == SSL_ERROR_WANT_WRITE))
+		{
+			wantother = (err == other);
+			errno = EAGAIN;
+		}
+		else
+		{
+			errno = EIO;
+		}
+		return -1;
+	}
+
+ public:
+	OpenSSLTransport(SSL* session, bool renego)
+		: sess(session)
+#ifdef INSPIRCD_OPENSSL_ENABLE_RENEGO_DETECTION
+		, allowrenego(renego)
+		, renegotiated(false)
+#endif
+	{
+	}
+
+	~OpenSSLTransport()
+	{
+		SSL_free(sess);
+	}
+
+	ssize_t Read(char* buffer, size_t size, bool& wantwrite) CXX11_OVERRIDE
+	{
+		ERR_clear_error();
+		int ret = SSL_read(sess, buffer, size);
+#ifdef INSPIRCD_OPENSSL_ENABLE_RENEGO_DETECTION
+		if (renegotiated)
+		{
+			errno = EIO;
+			return -1;
+		}
+#endif
+		if (ret > 0)
+			return ret;
+		// The client closed the connection
+		if (ret == 0)
+			return 0;
+		return Error(ret, wantwrite, SSL_ERROR_WANT_WRITE);
+	}
+
+	ssize_t Write(const char* buffer, size_t size, bool& wantread) CXX11_OVERRIDE
+	{
+		ERR_clear_error();
+		int ret = SSL_write(sess, buffer, size);
+#ifdef INSPIRCD_OPENSSL_ENABLE_RENEGO_DETECTION
+		if (renegotiated)
+		{
+			errno = EIO;
+			return -1;
+		}
+#endif
+		if (ret > 0)
+			return ret;
+		return Error(ret, wantread, SSL_ERROR_WANT_READ);
+	}
+
+	void Close() CXX11_OVERRIDE
+	{
+		ERR_clear_error();
+		SSL_shutdown(sess);
+	}
+
+#ifdef INSPIRCD_OPENSSL_ENABLE_RENEGO_DETECTION
+	static void InfoCallback(const SSL* ssl, int where, int rc)
+	{
+		OpenSSLTransport* transport = static_cast<OpenSSLTransport*>(SSL_get_ex_data(ssl, exdataindex));
+		if ((where & SSL_CB_HANDSHAKE_START) && (!transport->allowrenego))
+			transport->renegotiated = true;
+	}
+#endif
+};
+
 class OpenSSLIOHook : public SSLIOHook
 {
  private:
@@ -354,6 +454,9 @@ class OpenSSLIOHook : public SSLIOHook
 	bool data_to_write;
 	reference<OpenSSL::Profile> profile;
 
+	/** Name of the cipher in use, known once the handshake is done */
+	std::string cipher;
+
 	bool Handshake(StreamSocket* user)
 	{
 		int ret;
@@ -391,6 +494,7 @@ class OpenSSLIOHook : public SSLIOHook
 		{
 			// Handshake complete.
 			VerifyCertificate();
+			cipher = SSL_get_cipher(sess);
 
 			status = ISSL_OPEN;
 
@@ -529,7 +633,7 @@ class OpenSSLIOHook : public SSLIOHook
 		CloseSession();
 	}
 
-	int OnStreamSocketRead(StreamSocket* user, std::string& recvq) CXX11_OVERRIDE
+	int OnStreamSocketRead(StreamSocket* user, RecvQueue& recvq) CXX11_OVERRIDE
 	{
 		if (!sess)
 		{
@@ -554,9 +658,8 @@ class OpenSSLIOHook : public SSLIOHook
 		if (status == ISSL_OPEN)
 		{
 			ERR_clear_error();
-			char* buffer = ServerInstance->GetReadBuffer();
 			size_t bufsiz = ServerInstance->Config->NetBufferSize;
-			int ret = SSL_read(sess, buffer, bufsiz);
+			int ret = SSL_read(sess, recvq.GetWriteBuffer(bufsiz), bufsiz);
 
 #ifdef INSPIRCD_OPENSSL_ENABLE_RENEGO_DETECTION
 			if (!CheckRenego(user))
@@ -565,7 +668,7 @@ class OpenSSLIOHook : public SSLIOHook
 
 			if (ret > 0)
 			{
-				recvq.append(buffer, ret);
+				recvq.Commit(ret);
 				if (data_to_write)
 					SocketEngine::ChangeEventMask(user, FD_WANT_POLL_READ | FD_WANT_SINGLE_WRITE);
 				return 1;
@@ -674,11 +777,26 @@ class OpenSSLIOHook : public SSLIOHook
 		return 0;
 	}
 
+	IOHookTransport* DetachTransport(StreamSocket* sock) CXX11_OVERRIDE
+	{
+		// A write which has to be retried with the same buffer can't be handed over
+		if ((!sess) || (status != ISSL_OPEN) || (data_to_write))
+			return NULL;
+
+		OpenSSLTransport* transport = new OpenSSLTransport(sess, profile->AllowRenegotiation());
+		SSL_set_ex_data(sess, exdataindex, transport);
+#ifdef INSPIRCD_OPENSSL_ENABLE_RENEGO_DETECTION
+		SSL_set_info_callback(sess, OpenSSLTransport::InfoCallback);
+#endif
+		sess = NULL;
+		return transport;
+	}
+
 	void TellCiphersAndFingerprint(LocalUser* user)
 	{
-		if (sess)
+		if (certificate)
 		{
-			std::string text = "*** You are connected using SSL cipher '" + std::string(SSL_get_cipher(sess)) + "'";
+			std::string text = "*** You are connected using SSL cipher '" + cipher + "'";
 			const std::string& fingerprint = certificate->fingerprint;
 			if (!fingerprint.empty())
 				text += " and your SSL certificate fingerprint is " + fingerprint;
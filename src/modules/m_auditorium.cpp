@@ -103,11 +103,11 @@ class ModuleAuditorium : public Module
 		if (IsVisible(memb))
 			return;
 
-		const Channel::MemberMap& users = memb->chan->GetUsers();
-		for (Channel::MemberMap::const_iterator i = users.begin(); i != users.end(); ++i)
+		const Channel::LocalMemberList& users = memb->chan->GetLocalUsers();
+		for (Channel::LocalMemberList::const_iterator i = users.begin(); i != users.end(); ++i)
 		{
-			if (IS_LOCAL(i->first) && !CanSee(i->first, memb))
-				excepts.insert(i->first);
+			if (!CanSee((*i)->user, memb))
+				excepts.insert((*i)->user);
 		}
 	}
 
@@ -126,7 +126,7 @@ class ModuleAuditorium : public Module
 		BuildExcept(memb, excepts);
 	}
 
-	void OnBuildNeighborList(User* source, IncludeChanList& include, std::map<User*, bool>& exception) CXX11_OVERRIDE
+	void OnBuildNeighborList(User* source, IncludeChanList& include, NeighborExceptions& exception) CXX11_OVERRIDE
 	{
 		for (IncludeChanList::iterator i = include.begin(); i != include.end(); )
 		{
@@ -140,11 +140,11 @@ class ModuleAuditorium : public Module
 			// this channel should not be considered when listing my neighbors
 			i = include.erase(i);
 			// however, that might hide me from ops that can see me...
-			const Channel::MemberMap& users = memb->chan->GetUsers();
-			for(Channel::MemberMap::const_iterator j = users.begin(); j != users.end(); ++j)
+			const Channel::LocalMemberList& users = memb->chan->GetLocalUsers();
+			for (Channel::LocalMemberList::const_iterator j = users.begin(); j != users.end(); ++j)
 			{
-				if (IS_LOCAL(j->first) && CanSee(j->first, memb))
-					exception[j->first] = true;
+				if (CanSee((*j)->user, memb))
+					exception[(*j)->user] = true;
 			}
 		}
 	}
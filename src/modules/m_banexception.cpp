@@ -49,6 +49,7 @@ class ModuleBanException : public Module
  public:
 	ModuleBanException() : be(this)
 	{
+		cacheablebanchecks = true;
 	}
 
 	void On005Numeric(std::map<std::string, std::string>& tokens) CXX11_OVERRIDE
@@ -58,16 +59,11 @@ class ModuleBanException : public Module
 
 	ModResult OnExtBanCheck(User *user, Channel *chan, char type) CXX11_OVERRIDE
 	{
-		ListModeBase::ModeList* list = be.GetList(chan);
-		if (!list)
-			return MOD_RES_PASSTHRU;
-
-		for (ListModeBase::ModeList::iterator it = list->begin(); it != list->end(); it++)
+		std::vector<const ListModeBase::ListItem*> list;
+		be.FindExtBans(chan, type, list);
+		for (std::vector<const ListModeBase::ListItem*>::const_iterator it = list.begin(); it != list.end(); ++it)
 		{
-			if (it->mask[0] != type || it->mask[1] != ':')
-				continue;
-
-			if (chan->CheckBan(user, it->mask.substr(2)))
+			if (chan->CheckBan(user, (*it)->mask.substr(2)))
 			{
 				// They match an entry on the list, so let them pass this.
 				return MOD_RES_ALLOW;
@@ -79,16 +75,11 @@ class ModuleBanException : public Module
 
 	ModResult OnCheckChannelBan(User* user, Channel* chan) CXX11_OVERRIDE
 	{
-		ListModeBase::ModeList* list = be.GetList(chan);
-		if (!list)
-		{
-			// No list, proceed normally
-			return MOD_RES_PASSTHRU;
-		}
-
-		for (ListModeBase::ModeList::iterator it = list->begin(); it != list->end(); it++)
+		std::vector<const ListModeBase::ListItem*> list;
+		be.FindItems(chan, user, list);
+		for (std::vector<const ListModeBase::ListItem*>::const_iterator it = list.begin(); it != list.end(); ++it)
 		{
-			if (chan->CheckBan(user, it->mask))
+			if (chan->CheckBan(user, (*it)->matcher, (*it)->cidr))
 			{
 				// They match an entry on the list, so let them in.
 				return MOD_RES_ALLOW;
@@ -87,6 +87,9 @@ class CommandCAP : public Command
 		else if (subcommand == "END")
 		{
 			reghold.set(user, 0);
+			LocalUser* localuser = IS_LOCAL(user);
+			if (localuser)
+				localuser->CheckReady();
 		}
 		else if ((subcommand == "LS") || (subcommand == "LIST"))
 		{
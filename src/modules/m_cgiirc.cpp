@@ -103,8 +103,7 @@ class CommandWebirc : public Command
 						// Where the magic happens - change their IP
 						ChangeIP(user, parameters[3]);
 						// And follow this up by changing their host
-						user->host = user->dhost = newhost;
-						user->InvalidateCache();
+						user->ChangeRealHost(newhost, true);
 
 						return CMD_SUCCESS;
 					}
@@ -150,8 +149,7 @@ class CGIResolver : public DNS::Request
 			if (notify)
 				ServerInstance->SNO->WriteGlobalSno('w', "Connecting user %s detected as using CGI:IRC (%s), changing real host to %s from %s", them->nick.c_str(), them->host.c_str(), ans_record.rdata.c_str(), typ.c_str());
 
-			them->host = them->dhost = ans_record.rdata;
-			them->InvalidateCache();
+			them->ChangeRealHost(ans_record.rdata, true);
 			lu->CheckLines(true);
 		}
 	}
@@ -170,12 +168,14 @@ class CGIResolver : public DNS::Request
 
 	~CGIResolver()
 	{
-		User* them = ServerInstance->FindUUID(theiruid);
+		User* u = ServerInstance->FindUUID(theiruid);
+		LocalUser* them = u ? IS_LOCAL(u) : NULL;
 		if (!them)
 			return;
 		int count = waiting.get(them);
 		if (count)
 			waiting.set(them, count - 1);
+		them->CheckReady();
 	}
 };
 
@@ -197,8 +197,7 @@ class ModuleCgiIRC : public Module
 		cmd.realhost.set(user, user->host);
 		cmd.realip.set(user, user->GetIPString());
 		ChangeIP(user, newip);
-		user->host = user->dhost = user->GetIPString();
-		user->InvalidateCache();
+		user->ChangeRealHost(user->GetIPString(), true);
 		RecheckClass(user);
 
 		// Don't create the resolver if the core couldn't put the user in a connect class or when dns is disabled
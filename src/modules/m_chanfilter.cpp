@@ -95,7 +95,7 @@ class ModuleChanFilter : public Module
 		{
 			for (ListModeBase::ModeList::iterator i = list->begin(); i != list->end(); i++)
 			{
-				if (InspIRCd::Match(text, i->mask))
+				if (i->matcher.Match(text))
 				{
 					if (hidemask)
 						user->WriteNumeric(ERR_CANNOTSENDTOCHAN, "%s :Cannot send to channel (your message contained a censored word)", chan->name.c_str());
@@ -23,6 +23,11 @@
 class ModuleBadChannelExtban : public Module
 {
  public:
+	ModuleBadChannelExtban()
+	{
+		cacheablebanchecks = true;
+	}
+
 	Version GetVersion() CXX11_OVERRIDE
 	{
 		return Version("Extban 'j' - channel status/join ban", VF_OPTCOMMON|VF_VENDOR);
@@ -32,6 +37,8 @@ class ModuleBadChannelExtban : public Module
 	{
 		if ((mask.length() > 2) && (mask[0] == 'j') && (mask[1] == ':'))
 		{
+			// The result depends on the channels the user is on
+			Channel::MarkBanCheckVolatile();
 			std::string rm = mask.substr(2);
 			char status = 0;
 			ModeHandler* mh = ServerInstance->Modes->FindPrefix(rm[0]);
@@ -156,7 +156,7 @@ class ModuleClearChan : public Module
 		ServerInstance->Modules->DetachAll(this);
 	}
 
-	void OnBuildNeighborList(User* source, IncludeChanList& include, std::map<User*, bool>& exception) CXX11_OVERRIDE
+	void OnBuildNeighborList(User* source, IncludeChanList& include, NeighborExceptions& exception) CXX11_OVERRIDE
 	{
 		bool found = false;
 		for (IncludeChanList::iterator i = include.begin(); i != include.end(); ++i)
@@ -170,13 +170,10 @@ class ModuleClearChan : public Module
 			}
 		}
 
-		const Channel::MemberMap& users = cmd.activechan->GetUsers();
-		for (Channel::MemberMap::const_iterator i = users.begin(); i != users.end(); ++i)
+		const Channel::LocalMemberList& users = cmd.activechan->GetLocalUsers();
+		for (Channel::LocalMemberList::const_iterator i = users.begin(); i != users.end(); ++i)
 		{
-			LocalUser* curr = IS_LOCAL(i->first);
-			if (!curr)
-				continue;
-
+			LocalUser* curr = static_cast<LocalUser*>((*i)->user);
 			if (curr->IsOper())
 			{
 				// If another module has removed the channel we're working on from the list of channels
@@ -200,11 +197,11 @@ class ModuleClearChan : public Module
 	{
 		// Hide the KICK from all non-opers
 		User* leaving = memb->user;
-		const Channel::MemberMap& users = memb->chan->GetUsers();
-		for (Channel::MemberMap::const_iterator i = users.begin(); i != users.end(); ++i)
+		const Channel::LocalMemberList& users = memb->chan->GetLocalUsers();
+		for (Channel::LocalMemberList::const_iterator i = users.begin(); i != users.end(); ++i)
 		{
-			User* curr = i->first;
-			if ((IS_LOCAL(curr)) && (!curr->IsOper()) && (curr != leaving))
+			User* curr = (*i)->user;
+			if ((!curr->IsOper()) && (curr != leaving))
 				excepts.insert(curr);
 		}
 	}
@@ -144,6 +144,7 @@ class ModuleCloaking : public Module
 
 	ModuleCloaking() : cu(this), mode(MODE_OPAQUE), ck(this), Hash(this, "hash/md5")
 	{
+		cacheablebanchecks = true;
 	}
 
 	/** This function takes a domain name string and returns just the last two domain parts,
@@ -288,6 +289,19 @@ class ModuleCloaking : public Module
 		return MOD_RES_PASSTHRU;
 	}
 
+	void OnBuildBanHostList(User* user, std::vector<std::string>& hosts) CXX11_OVERRIDE
+	{
+		LocalUser* lu = IS_LOCAL(user);
+		if (!lu)
+			return;
+
+		OnUserConnect(lu);
+		std::string* cloak = cu.ext.get(user);
+		/* Bans on their cloaked host apply even if they are not using it, see OnCheckBan */
+		if (cloak && *cloak != user->dhost)
+			hosts.push_back(*cloak);
+	}
+
 	void Prioritize()
 	{
 		/* Needs to be after m_banexception etc. */
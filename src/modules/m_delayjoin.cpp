@@ -49,7 +49,7 @@ class ModuleDelayJoin : public Module
 	void CleanUser(User* user);
 	void OnUserPart(Membership*, std::string &partmessage, CUList&) CXX11_OVERRIDE;
 	void OnUserKick(User* source, Membership*, const std::string &reason, CUList&) CXX11_OVERRIDE;
-	void OnBuildNeighborList(User* source, IncludeChanList& include, std::map<User*, bool>& exception) CXX11_OVERRIDE;
+	void OnBuildNeighborList(User* source, IncludeChanList& include, NeighborExceptions& exception) CXX11_OVERRIDE;
 	void OnText(User* user, void* dest, int target_type, const std::string &text, char status, CUList &exempt_list) CXX11_OVERRIDE;
 	ModResult OnRawMode(User* user, Channel* channel, ModeHandler* mh, const std::string& param, bool adding) CXX11_OVERRIDE;
 };
@@ -94,12 +94,12 @@ ModResult ModuleDelayJoin::OnNamesListItem(User* issuer, Membership* memb, std::
 
 static void populate(CUList& except, Membership* memb)
 {
-	const Channel::MemberMap& users = memb->chan->GetUsers();
-	for (Channel::MemberMap::const_iterator i = users.begin(); i != users.end(); ++i)
+	const Channel::LocalMemberList& users = memb->chan->GetLocalUsers();
+	for (Channel::LocalMemberList::const_iterator i = users.begin(); i != users.end(); ++i)
 	{
-		if (i->first == memb->user || !IS_LOCAL(i->first))
+		if ((*i)->user == memb->user)
 			continue;
-		except.insert(i->first);
+		except.insert((*i)->user);
 	}
 }
 
@@ -124,7 +124,7 @@ void ModuleDelayJoin::OnUserKick(User* source, Membership* memb, const std::stri
 		populate(except, memb);
 }
 
-void ModuleDelayJoin::OnBuildNeighborList(User* source, IncludeChanList& include, std::map<User*, bool>& exception)
+void ModuleDelayJoin::OnBuildNeighborList(User* source, IncludeChanList& include, NeighborExceptions& exception)
 {
 	for (IncludeChanList::iterator i = include.begin(); i != include.end(); )
 	{
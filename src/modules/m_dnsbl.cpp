@@ -71,6 +71,7 @@ class DNSBLResolver : public DNS::Request
 		int i = countExt.get(them);
 		if (i)
 			countExt.set(them, i - 1);
+		them->CheckReady();
 
 		// Now we calculate the bitmask: 256*(256*(256*a+b)+c)+d
 
@@ -204,6 +205,7 @@ class DNSBLResolver : public DNS::Request
 		int i = countExt.get(them);
 		if (i)
 			countExt.set(them, i - 1);
+		them->CheckReady();
 
 		if (q->error == DNS::ERROR_NO_RECORDS || q->error == DNS::ERROR_DOMAIN_NOT_FOUND)
 			ConfEntry->stats_misses++;
@@ -61,7 +61,7 @@ class FlashPDSocket : public BufferedSocket, public Timer, public insp::intrusiv
 
 	void OnDataReady() CXX11_OVERRIDE
 	{
-		if (recvq == expected_request)
+		if (recvq.str() == expected_request)
 			WriteData(policy_reply);
 		AddToCull();
 	}
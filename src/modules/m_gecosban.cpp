@@ -22,6 +22,11 @@
 class ModuleGecosBan : public Module
 {
  public:
+	ModuleGecosBan()
+	{
+		cacheablebanchecks = true;
+	}
+
 	Version GetVersion() CXX11_OVERRIDE
 	{
 		return Version("Extban 'r' - realname (gecos) ban", VF_OPTCOMMON|VF_VENDOR);
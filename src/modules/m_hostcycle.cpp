@@ -33,11 +33,11 @@ class ModuleHostCycle : public Module
 		already_sent_t seen_id = ++LocalUser::already_sent_id;
 
 		IncludeChanList include_chans(user->chans.begin(), user->chans.end());
-		std::map<User*,bool> exceptions;
+		NeighborExceptions exceptions;
 
 		FOREACH_MOD(OnBuildNeighborList, (user, include_chans, exceptions));
 
-		for (std::map<User*,bool>::iterator i = exceptions.begin(); i != exceptions.end(); ++i)
+		for (NeighborExceptions::iterator i = exceptions.begin(); i != exceptions.end(); ++i)
 		{
 			LocalUser* u = IS_LOCAL(i->first);
 			if (u && !u->quitting)
@@ -72,11 +72,11 @@ class ModuleHostCycle : public Module
 					modeline.append(" ").append(user->nick);
 			}
 
-			const Channel::MemberMap& ulist = c->GetUsers();
-			for (Channel::MemberMap::const_iterator j = ulist.begin(); j != ulist.end(); ++j)
+			const Channel::LocalMemberList& ulist = c->GetLocalUsers();
+			for (Channel::LocalMemberList::const_iterator j = ulist.begin(); j != ulist.end(); ++j)
 			{
-				LocalUser* u = IS_LOCAL(j->first);
-				if (u == NULL || u == user)
+				LocalUser* u = static_cast<LocalUser*>((*j)->user);
+				if (u == user)
 					continue;
 				if (u->already_sent == silent_id)
 					continue;
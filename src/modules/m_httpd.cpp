@@ -219,13 +219,15 @@ class HttpServerSocket : public BufferedSocket, public Timer, public insp::intru
 	{
 		if (InternalState == HTTP_SERVE_RECV_POSTDATA)
 		{
-			postdata.append(recvq);
+			postdata.append(recvq.data(), recvq.length());
+			recvq.clear();
 			if (postdata.length() >= postsize)
 				ServeData();
 		}
 		else
 		{
-			reqbuffer.append(recvq);
+			reqbuffer.append(recvq.data(), recvq.length());
+			recvq.clear();
 
 			if (reqbuffer.length() >= 8192)
 			{
@@ -62,13 +62,16 @@
  *      checking if the ident socket has a result. This is done
  *      by checking if the age the of the class (its instantiation
  *      time) plus the timeout value is greater than the current time.
+ *      The user's own timeout timer is asked to check them again
+ *      once the timeout is reached.
  *
  *  O   The ident socket is able to but should not modify its
  *      'parent' user directly. Instead the ident socket class sets
- *      a completion flag and during the next call to OnCheckReady,
- *      the completion flag will be checked and any result copied to
- *      that user's class. This again ensures a single point of socket
- *      deletion for safer, neater code.
+ *      a completion flag and asks for its 'parent' user to be checked
+ *      again. During the next call to OnCheckReady, the completion
+ *      flag will be checked and any result copied to that user's
+ *      class. This again ensures a single point of socket deletion
+ *      for safer, neater code.
  *
  *  O   The code in the constructor of the ident socket is taken from
  *      BufferedSocket but majorly thinned down. It works for both
@@ -160,7 +163,7 @@ class IdentRequestSocket : public EventHandler
 		 * might as well give up if this happens!
 		 */
 		if (SocketEngine::Send(this, req, req_size, 0) < req_size)
-			done = true;
+			SetDone();
 	}
 
 	void HandleEvent(EventType et, int errornum = 0)
@@ -182,7 +185,7 @@ class IdentRequestSocket : public EventHandler
 				 * huge storm of EVENT_ERROR events!
 				 */
 				Close();
-				done = true;
+				SetDone();
 			break;
 		}
 	}
@@ -204,6 +207,12 @@ class IdentRequestSocket : public EventHandler
 		return done;
 	}
 
+	void SetDone()
+	{
+		done = true;
+		user->CheckReady();
+	}
+
 	void ReadResponse()
 	{
 		/* We don't really need to buffer for incomplete replies here, since IDENT replies are
@@ -216,7 +225,7 @@ class IdentRequestSocket : public EventHandler
 		 * and flag as done since the ident lookup has finished
 		 */
 		Close();
-		done = true;
+		SetDone();
 
 		/* Cant possibly be a valid response shorter than 3 chars,
 		 * because the shortest possible response would look like: '1,1'
@@ -305,6 +314,7 @@ class ModuleIdent : public Module
 		{
 			IdentRequestSocket *isock = new IdentRequestSocket(user);
 			ext.set(user, isock);
+			user->CheckReady(RequestTimeout);
 		}
 		catch (ModuleException &e)
 		{
@@ -312,7 +322,8 @@ class ModuleIdent : public Module
 		}
 	}
 
-	/* This triggers pretty regularly, we can use it in preference to
+	/* This triggers when the ident socket finishes and when the timeout
+	 * asked for in OnUserInit is reached, we can use it in preference to
 	 * creating a Timer object and especially better than creating a
 	 * Timer per ident lookup!
 	 */
@@ -338,7 +349,8 @@ class ModuleIdent : public Module
 		}
 		else if (!isock->HasResult())
 		{
-			// time still good, no result yet... hold the registration
+			// time still good, no result yet... hold the registration and make sure we are asked again when it runs out
+			user->CheckReady(compare - ServerInstance->Time());
 			return MOD_RES_DENY;
 		}
 
@@ -58,16 +58,12 @@ public:
 
 	ModResult OnCheckInvite(User* user, Channel* chan) CXX11_OVERRIDE
 	{
-		ListModeBase::ModeList* list = ie.GetList(chan);
-		if (list)
+		std::vector<const ListModeBase::ListItem*> list;
+		ie.FindItems(chan, user, list);
+		for (std::vector<const ListModeBase::ListItem*>::const_iterator it = list.begin(); it != list.end(); ++it)
 		{
-			for (ListModeBase::ModeList::iterator it = list->begin(); it != list->end(); it++)
-			{
-				if (chan->CheckBan(user, it->mask))
-				{
-					return MOD_RES_ALLOW;
-				}
-			}
+			if (chan->CheckBan(user, (*it)->matcher, (*it)->cidr))
+				return MOD_RES_ALLOW;
 		}
 
 		return MOD_RES_PASSTHRU;
@@ -20,6 +20,27 @@
 #include "modules/account.h"
 #include "modules/cap.h"
 
+/** Sends a line to the neighbors of a user who have a given extension set, e.g. a cap
+ */
+class WriteNeighborsWithExtHandler : public User::ForEachNeighborHandler
+{
+	const std::string& line;
+	const LocalIntExt& ext;
+
+	void Execute(LocalUser* user) CXX11_OVERRIDE
+	{
+		if (ext.get(user))
+			user->Write(line);
+	}
+
+ public:
+	WriteNeighborsWithExtHandler(const std::string& msg, const LocalIntExt& extension)
+		: line(msg)
+		, ext(extension)
+	{
+	}
+};
+
 class ModuleIRCv3 : public Module
 {
 	GenericCap cap_accountnotify;
@@ -33,40 +54,8 @@ class ModuleIRCv3 : public Module
 
 	void WriteNeighboursWithExt(User* user, const std::string& line, const LocalIntExt& ext)
 	{
-		IncludeChanList chans(user->chans.begin(), user->chans.end());
-
-		std::map<User*, bool> exceptions;
-		FOREACH_MOD(OnBuildNeighborList, (user, chans, exceptions));
-
-		// Send it to all local users who were explicitly marked as neighbours by modules and have the required ext
-		for (std::map<User*, bool>::const_iterator i = exceptions.begin(); i != exceptions.end(); ++i)
-		{
-			LocalUser* u = IS_LOCAL(i->first);
-			if ((u) && (i->second) && (ext.get(u)))
-				u->Write(line);
-		}
-
-		// Now consider sending it to all other users who has at least a common channel with the user
-		std::set<User*> already_sent;
-		for (IncludeChanList::const_iterator i = chans.begin(); i != chans.end(); ++i)
-		{
-			const Channel::MemberMap& userlist = (*i)->chan->GetUsers();
-			for (Channel::MemberMap::const_iterator m = userlist.begin(); m != userlist.end(); ++m)
-			{
-				/*
-				 * Send the line if the channel member in question meets all of the following criteria:
-				 * - local
-				 * - not the user who is doing the action (i.e. whose channels we're iterating)
-				 * - has the given extension
-				 * - not on the except list built by modules
-				 * - we haven't sent the line to the member yet
-				 *
-				 */
-				LocalUser* member = IS_LOCAL(m->first);
-				if ((member) && (member != user) && (ext.get(member)) && (exceptions.find(member) == exceptions.end()) && (already_sent.insert(member).second))
-					member->Write(line);
-			}
-		}
+		WriteNeighborsWithExtHandler handler(line, ext);
+		user->ForEachNeighbor(handler, false);
 	}
 
  public:
@@ -134,12 +123,12 @@ class ModuleIRCv3 : public Module
 		std::string line;
 		std::string mode;
 
-		const Channel::MemberMap& userlist = memb->chan->GetUsers();
-		for (Channel::MemberMap::const_iterator it = userlist.begin(); it != userlist.end(); ++it)
+		const Channel::LocalMemberList& userlist = memb->chan->GetLocalUsers();
+		for (Channel::LocalMemberList::const_iterator it = userlist.begin(); it != userlist.end(); ++it)
 		{
-			// Send the extended join line if the current member is local, has the extended-join cap and isn't excepted
-			User* member = IS_LOCAL(it->first);
-			if ((member) && (cap_extendedjoin.ext.get(member)) && (excepts.find(member) == excepts.end()))
+			// Send the extended join line if the current member has the extended-join cap and isn't excepted
+			User* member = (*it)->user;
+			if ((cap_extendedjoin.ext.get(member)) && (excepts.find(member) == excepts.end()))
 			{
 				// Construct the lines we're going to send if we haven't constructed them already
 				if (line.empty())
@@ -181,7 +170,7 @@ class ModuleIRCv3 : public Module
 					member->Write(mode);
 
 				// Prevent the core from sending the JOIN and MODE to this user
-				excepts.insert(it->first);
+				excepts.insert(member);
 			}
 		}
 	}
@@ -208,12 +197,12 @@ class ModuleIRCv3 : public Module
 
 		std::string line = ":" + memb->user->GetFullHost() + " AWAY :" + memb->user->awaymsg;
 
-		const Channel::MemberMap& userlist = memb->chan->GetUsers();
-		for (Channel::MemberMap::const_iterator it = userlist.begin(); it != userlist.end(); ++it)
+		const Channel::LocalMemberList& userlist = memb->chan->GetLocalUsers();
+		for (Channel::LocalMemberList::const_iterator it = userlist.begin(); it != userlist.end(); ++it)
 		{
-			// Send the away notify line if the current member is local, has the away-notify cap and isn't excepted
-			User* member = IS_LOCAL(it->first);
-			if ((member) && (cap_awaynotify.ext.get(member)) && (last_excepts.find(member) == last_excepts.end()))
+			// Send the away notify line if the current member has the away-notify cap and isn't excepted
+			User* member = (*it)->user;
+			if ((cap_awaynotify.ext.get(member)) && (last_excepts.find(member) == last_excepts.end()))
 			{
 				member->Write(line);
 			}
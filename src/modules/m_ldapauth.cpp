@@ -74,6 +74,13 @@ class BindInterface : public LDAPInterface
 		return result;
 	}
 
+	static void CheckReady(User* user)
+	{
+		LocalUser* localuser = IS_LOCAL(user);
+		if (localuser)
+			localuser->CheckReady();
+	}
+
 	static void SetVHost(User* user, const std::string& DN)
 	{
 		if (!vhost.empty())
@@ -124,6 +131,7 @@ class BindInterface : public LDAPInterface
 			// We're done, there are no attributes to check
 			SetVHost(user, DN);
 			authed->set(user, 1);
+			CheckReady(user);
 
 			delete this;
 			return;
@@ -139,6 +147,7 @@ class BindInterface : public LDAPInterface
 
 				SetVHost(user, DN);
 				authed->set(user, 1);
+				CheckReady(user);
 			}
 
 			// Delete this if this is the last ref
@@ -25,6 +25,15 @@
  * 989 <nick> <servername> :Open for new connections
  */
 
+/** Checks the users held back while the server was locked again, nothing else would do so until they time out
+ */
+static void ReleaseUsers()
+{
+	const UserManager::LocalList& list = ServerInstance->Users.GetLocalUsers();
+	for (UserManager::LocalList::const_iterator i = list.begin(); i != list.end(); ++i)
+		(*i)->CheckReady();
+}
+
 class CommandLockserv : public Command
 {
 	bool& locked;
@@ -69,6 +78,7 @@ class CommandUnlockserv : public Command
 		}
 
 		locked = false;
+		ReleaseUsers();
 		user->WriteNumeric(989, "%s :Open for new connections", user->server->GetName().c_str());
 		ServerInstance->SNO->WriteGlobalSno('a', "Oper %s used UNLOCKSERV to allow new connections", user->nick.c_str());
 		return CMD_SUCCESS;
@@ -94,8 +104,11 @@ class ModuleLockserv : public Module
 	void ReadConfig(ConfigStatus& status) CXX11_OVERRIDE
 	{
 		// Emergency way to unlock
-		if (!status.srcuser)
+		if ((!status.srcuser) && (locked))
+		{
 			locked = false;
+			ReleaseUsers();
+		}
 	}
 
 	ModResult OnUserRegister(LocalUser* user) CXX11_OVERRIDE
@@ -38,6 +38,7 @@ class ModuleOperChans : public Module
  public:
 	ModuleOperChans() : oc(this)
 	{
+		cacheablebanchecks = true;
 	}
 
 	ModResult OnUserPreJoin(LocalUser* user, Channel* chan, const std::string& cname, std::string& privs, const std::string& keygiven) CXX11_OVERRIDE
@@ -55,6 +56,8 @@ class ModuleOperChans : public Module
 	{
 		if ((mask.length() > 2) && (mask[0] == 'O') && (mask[1] == ':'))
 		{
+			// The result depends on the oper status of the user
+			Channel::MarkBanCheckVolatile();
 			if (user->IsOper() && InspIRCd::Match(user->oper->name, mask.substr(2)))
 				return MOD_RES_DENY;
 		}
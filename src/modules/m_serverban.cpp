@@ -22,6 +22,11 @@
 class ModuleServerBan : public Module
 {
  public:
+	ModuleServerBan()
+	{
+		cacheablebanchecks = true;
+	}
+
 	Version GetVersion() CXX11_OVERRIDE
 	{
 		return Version("Extban 's' - server ban",VF_OPTCOMMON|VF_VENDOR);
@@ -150,6 +150,7 @@ class ModuleServicesAccount : public Module
 		accountname(this)
 		, checking_ban(false)
 	{
+		cacheablebanchecks = true;
 	}
 
 	void On005Numeric(std::map<std::string, std::string>& tokens) CXX11_OVERRIDE
@@ -223,6 +224,10 @@ class ModuleServicesAccount : public Module
 
 		if ((mask.length() > 2) && (mask[1] == ':'))
 		{
+			// The result of both extbans depends on the account the user is logged into
+			if ((mask[0] == 'R') || (mask[0] == 'U'))
+				Channel::MarkBanCheckVolatile();
+
 			if (mask[0] == 'R')
 			{
 				std::string *account = accountname.get(user);
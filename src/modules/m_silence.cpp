@@ -316,15 +316,12 @@ class ModuleSilence : public Module
 	{
 		int public_silence = (message_type == MSG_PRIVMSG ? SILENCE_CHANNEL : SILENCE_CNOTICE);
 
-		const Channel::MemberMap& ulist = chan->GetUsers();
-		for (Channel::MemberMap::const_iterator i = ulist.begin(); i != ulist.end(); ++i)
+		const Channel::LocalMemberList& ulist = chan->GetLocalUsers();
+		for (Channel::LocalMemberList::const_iterator i = ulist.begin(); i != ulist.end(); ++i)
 		{
-			if (IS_LOCAL(i->first))
+			if (MatchPattern((*i)->user, sender, public_silence) == MOD_RES_DENY)
 			{
-				if (MatchPattern(i->first, sender, public_silence) == MOD_RES_DENY)
-				{
-					exempt_list.insert(i->first);
-				}
+				exempt_list.insert((*i)->user);
 			}
 		}
 	}
@@ -39,6 +39,13 @@ class AuthQuery : public SQLQuery
 	{
 	}
 
+	static void CheckReady(User* user)
+	{
+		LocalUser* localuser = IS_LOCAL(user);
+		if (localuser)
+			localuser->CheckReady();
+	}
+
 	void OnResult(SQLResult& res) CXX11_OVERRIDE
 	{
 		User* user = ServerInstance->FindNick(uid);
@@ -54,6 +61,7 @@ class AuthQuery : public SQLQuery
 				ServerInstance->SNO->WriteGlobalSno('a', "Forbidden connection from %s (SQL query returned no matches)", user->GetFullRealHost().c_str());
 			pendingExt.set(user, AUTH_STATE_FAIL);
 		}
+		CheckReady(user);
 	}
 
 	void OnError(SQLerror& error) CXX11_OVERRIDE
@@ -64,6 +72,7 @@ class AuthQuery : public SQLQuery
 		pendingExt.set(user, AUTH_STATE_FAIL);
 		if (verbose)
 			ServerInstance->SNO->WriteGlobalSno('a', "Forbidden connection from %s (SQL query failed: %s)", user->GetFullRealHost().c_str(), error.Str());
+		CheckReady(user);
 	}
 };
 
@@ -89,6 +89,7 @@ class ModuleSSLModes : public Module
 	ModuleSSLModes()
 		: sslm(this)
 	{
+		cacheablebanchecks = true;
 	}
 
 	ModResult OnUserPreJoin(LocalUser* user, Channel* chan, const std::string& cname, std::string& privs, const std::string& keygiven) CXX11_OVERRIDE
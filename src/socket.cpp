@@ -38,6 +38,16 @@ int InspIRCd::BindPorts(FailedPortList &failed_ports)
 		if (strncasecmp(Addr.c_str(), "::ffff:", 7) == 0)
 			this->Logs->Log("SOCKET", LOG_DEFAULT, "Using 4in6 (::ffff:) isn't recommended. You should bind IPv4 addresses directly instead.");
 
+		// With <bind:reuseport> each port gets several sockets sharing the address, each with its own accept queue
+		long shards = tag->getInt("reuseport", 1, 1, 64);
+#ifndef SO_REUSEPORT
+		if (shards > 1)
+		{
+			this->Logs->Log("SOCKET", LOG_DEFAULT, "<bind:reuseport> is not supported on this system, binding only one socket per port.");
+			shards = 1;
+		}
+#endif
+
 		irc::portparser portrange(porttag, false);
 		int portno = -1;
 		while (0 != (portno = portrange.GetToken()))
@@ -47,32 +57,35 @@ int InspIRCd::BindPorts(FailedPortList &failed_ports)
 				continue;
 			std::string bind_readable = bindspec.str();
 
-			bool skip = false;
-			for (std::vector<ListenSocket*>::iterator n = old_ports.begin(); n != old_ports.end(); ++n)
-			{
-				if ((**n).bind_desc == bind_readable)
-				{
-					(*n)->bind_tag = tag; // Replace tag, we know addr and port match, but other info (type, ssl) may not
-					(*n)->ResetIOHookProvider();
-
-					skip = true;
-					old_ports.erase(n);
-					break;
-				}
-			}
-			if (!skip)
+			for (long shard = 0; shard < shards; shard++)
 			{
-				ListenSocket* ll = new ListenSocket(tag, bindspec);
-
-				if (ll->GetFd() > -1)
+				bool skip = false;
+				for (std::vector<ListenSocket*>::iterator n = old_ports.begin(); n != old_ports.end(); ++n)
 				{
-					bound++;
-					ports.push_back(ll);
+					if ((**n).bind_desc == bind_readable)
+					{
+						(*n)->bind_tag = tag; // Replace tag, we know addr and port match, but other info (type, ssl) may not
+						(*n)->ResetIOHookProvider();
+
+						skip = true;
+						old_ports.erase(n);
+						break;
+					}
 				}
-				else
+				if (!skip)
 				{
-					failed_ports.push_back(std::make_pair(bind_readable, strerror(errno)));
-					delete ll;
+					ListenSocket* ll = new ListenSocket(tag, bindspec, shards > 1);
+
+					if (ll->GetFd() > -1)
+					{
+						bound++;
+						ports.push_back(ll);
+					}
+					else
+					{
+						failed_ports.push_back(std::make_pair(bind_readable, strerror(errno)));
+						delete ll;
+					}
 				}
 			}
 		}
@@ -309,8 +322,19 @@ bool irc::sockets::cidr_mask::operator<(const cidr_mask& other) const
 
 bool irc::sockets::cidr_mask::match(const irc::sockets::sockaddrs& addr) const
 {
-	if (addr.sa.sa_family != type)
+	const unsigned char* base;
+	if ((type == AF_INET) && (addr.sa.sa_family == AF_INET))
+		base = (const unsigned char*)&addr.in4.sin_addr;
+	else if ((type == AF_INET6) && (addr.sa.sa_family == AF_INET6))
+		base = (const unsigned char*)&addr.in6.sin6_addr;
+	else
 		return false;
-	irc::sockets::cidr_mask tmp(addr, length);
-	return tmp == *this;
+
+	// Compare the whole bytes covered by the mask, then the bits of the last partial byte
+	const unsigned int border = length / 8;
+	if (memcmp(bits, base, border))
+		return false;
+
+	const unsigned char bitmask = (0xFF00 >> (length & 7)) & 0xFF;
+	return ((!bitmask) || ((base[border] & bitmask) == bits[border]));
 }
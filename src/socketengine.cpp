@@ -23,6 +23,10 @@
 
 #include "inspircd.h"
 
+#ifndef DISABLE_WRITEV
+#include <sys/uio.h>
+#endif
+
 
 /** Reference table, contains all current handlers
  **/
@@ -34,7 +38,7 @@ size_t SocketEngine::CurrentSetSize = 0;
 
 /** List of handlers that want a trial read/write
  */
-std::set<int> SocketEngine::trials;
+std::vector<int> SocketEngine::trials;
 
 int SocketEngine::MAX_DESCRIPTORS;
 
@@ -66,22 +70,29 @@ void SocketEngine::ChangeEventMask(EventHandler* eh, int change)
 
 	// if adding a trial read/write, insert it into the set
 	if (change & FD_TRIAL_NOTE_MASK && !(old_m & FD_TRIAL_NOTE_MASK))
-		trials.insert(eh->GetFd());
+		trials.push_back(eh->GetFd());
 
 	new_m |= change;
 	if (new_m == old_m)
 		return;
 
 	eh->event_mask = new_m;
-	OnSetEvent(eh, old_m, new_m);
+	if (!(new_m & FD_DETACHED))
+		OnSetEvent(eh, old_m, new_m);
+}
+
+int SocketEngine::GetDispatchTimeout()
+{
+	// Wake up no later than the start of the next second
+	const long timeout = 1000 - ServerInstance->Time_ns() / 1000000;
+	return ServerInstance->Timers.GetNextTimeout(timeout);
 }
 
 void SocketEngine::DispatchTrialWrites()
 {
-	std::vector<int> working_list;
-	working_list.reserve(trials.size());
-	working_list.assign(trials.begin(), trials.end());
-	trials.clear();
+	// Sockets which gain output while we are flushing are flushed in the next iteration
+	static std::vector<int> working_list;
+	working_list.swap(trials);
 	for(unsigned int i=0; i < working_list.size(); i++)
 	{
 		int fd = working_list[i];
@@ -95,6 +106,7 @@ void SocketEngine::DispatchTrialWrites()
 		if ((mask & (FD_ADD_TRIAL_WRITE | FD_WRITE_WILL_BLOCK)) == FD_ADD_TRIAL_WRITE)
 			eh->HandleEvent(EVENT_WRITE, 0);
 	}
+	working_list.clear();
 }
 
 bool SocketEngine::AddFdRef(EventHandler* eh)
@@ -120,6 +132,20 @@ void SocketEngine::DelFdRef(EventHandler *eh)
 	}
 }
 
+void SocketEngine::DetachFd(EventHandler* eh)
+{
+	DelFd(eh);
+	AddFdRef(eh);
+	// Nothing resets the blocking flags of a detached socket, and they would suppress its trial writes
+	eh->event_mask = (eh->event_mask & ~(FD_WANT_READ_MASK | FD_WANT_WRITE_MASK | FD_READ_WILL_BLOCK | FD_WRITE_WILL_BLOCK)) | FD_WANT_NO_READ | FD_WANT_NO_WRITE | FD_DETACHED;
+}
+
+void SocketEngine::DelDetachedFd(EventHandler* eh)
+{
+	DelFdRef(eh);
+	eh->event_mask &= ~FD_DETACHED;
+}
+
 bool SocketEngine::HasFd(int fd)
 {
 	return GetRef(fd) != NULL;
@@ -141,11 +167,17 @@ bool SocketEngine::BoundsCheckFd(EventHandler* eh)
 	return true;
 }
 
-
+// A socket engine which submits the socket I/O itself implements Accept(), Send(), Recv() and WriteV()
+#ifndef SOCKETENGINE_OWNS_IO
 int SocketEngine::Accept(EventHandler* fd, sockaddr *addr, socklen_t *addrlen)
 {
+#ifdef HAS_ACCEPT4
+	return accept4(fd->GetFd(), addr, addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
 	return accept(fd->GetFd(), addr, addrlen);
+#endif
 }
+#endif
 
 int SocketEngine::Close(EventHandler* eh)
 {
@@ -200,6 +232,7 @@ int SocketEngine::RecvFrom(EventHandler* fd, void *buf, size_t len, int flags, s
 	return nbRecvd;
 }
 
+#ifndef SOCKETENGINE_OWNS_IO
 int SocketEngine::Send(EventHandler* fd, const void *buf, size_t len, int flags)
 {
 	int nbSent = send(fd->GetFd(), (const char*)buf, len, flags);
@@ -208,6 +241,16 @@ int SocketEngine::Send(EventHandler* fd, const void *buf, size_t len, int flags)
 	return nbSent;
 }
 
+#ifndef DISABLE_WRITEV
+int SocketEngine::WriteV(EventHandler* fd, const iovec* iov, int iovcnt)
+{
+	int nbSent = writev(fd->GetFd(), iov, iovcnt);
+	if (nbSent > 0)
+		stats.Update(0, nbSent);
+	return nbSent;
+}
+#endif
+
 int SocketEngine::Recv(EventHandler* fd, void *buf, size_t len, int flags)
 {
 	int nbRecvd = recv(fd->GetFd(), (char*)buf, len, flags);
@@ -215,6 +258,7 @@ int SocketEngine::Recv(EventHandler* fd, void *buf, size_t len, int flags)
 		stats.Update(nbRecvd, 0);
 	return nbRecvd;
 }
+#endif
 
 int SocketEngine::SendTo(EventHandler* fd, const void *buf, size_t len, int flags, const sockaddr *to, socklen_t tolen)
 {
@@ -119,10 +119,11 @@ void SocketEngine::DelFd(EventHandler* eh)
 
 int SocketEngine::DispatchEvents()
 {
+	const int timeout = GetDispatchTimeout();
 	struct timespec poll_time;
 
-	poll_time.tv_sec = 1;
-	poll_time.tv_nsec = 0;
+	poll_time.tv_sec = timeout / 1000;
+	poll_time.tv_nsec = (timeout % 1000) * 1000000;
 
 	unsigned int nget = 1; // used to denote a retrieve request.
 	int ret = port_getn(EngineHandle, &events[0], events.size(), &nget, &poll_time);
@@ -0,0 +1,1258 @@
+/*
+ * InspIRCd -- Internet Relay Chat Daemon
+ *
+ * This file is part of InspIRCd.  InspIRCd is free software: you can
+ * redistribute it and/or modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation, version 2.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "inspircd.h"
+#include "exitcodes.h"
+
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <iostream>
+
+/** A specialisation of the SocketEngine class, designed to use the Linux io_uring interface.
+ *
+ * The socket I/O of listeners and of stream sockets without an IOHook is submitted to the ring:
+ * - Such a socket which wants to read always has a recv operation in flight. The data lands in
+ *   one of a pool of buffers provided to the kernel, so idle connections don't hold a buffer.
+ * - Data written to it is copied into a per-socket buffer and sent by a send operation.
+ * - A listener always has an accept operation in flight.
+ * A completed recv or accept is dispatched as a read event, and the SocketEngine::Recv() or
+ * Accept() call of the handler returns its result without a system call.
+ *
+ * Everything else, including sockets whose IOHook reads and writes the fd itself, gets readiness
+ * notifications from one-shot IORING_OP_POLL_ADD operations.
+ *
+ * All operations queued during a main loop iteration are handed to the kernel in the same
+ * io_uring_enter() call that waits for completions, so a busy server makes one system call per
+ * iteration instead of an epoll_wait() plus one recv() or writev() per ready socket.
+ */
+namespace
+{
+	/** user_data of the timeout operation used when the kernel does not support IORING_ENTER_EXT_ARG */
+	const __u64 TIMEOUT_TAG = ~0ULL;
+
+	/** user_data of operations whose completion is not interesting (poll removals, cancellations, returned buffers) */
+	const __u64 IGNORE_TAG = ~0ULL - 1;
+
+	/** user_data of the operation which provides the receive buffers to the kernel for the first time */
+	const __u64 PROVIDE_TAG = ~0ULL - 2;
+
+	/** Kinds of operation on a fd, stored in the user_data next to the fd */
+	enum OpKind
+	{
+		OP_POLL,
+		OP_RECV,
+		OP_SEND,
+		OP_ACCEPT
+	};
+
+	/** How the I/O of an event handler is done */
+	enum IOMode
+	{
+		/** The handler does its own I/O when it is told the fd is ready */
+		MODE_POLL,
+		/** A stream socket whose recvs and sends are submitted to the ring */
+		MODE_STREAM,
+		/** A listener whose accepts are submitted to the ring */
+		MODE_LISTEN
+	};
+
+	/** Bits of the user_data which hold the fd, the two bits above hold the OpKind */
+	const unsigned int FD_BITS = 30;
+
+	/** Number of receive buffers provided to the kernel */
+	const unsigned int RECV_BUFFER_COUNT = 1024;
+
+	/** Buffer group of the receive buffers */
+	const __u16 RECV_BUFFER_GROUP = 0;
+
+	/** Maximum amount of data written to a socket which may wait in the engine to be sent.
+	 * Writes beyond this fail with EAGAIN, like they would when the kernel send buffer is full.
+	 */
+	const size_t MAX_UNSENT = 65536;
+
+	/** Send buffers with more capacity than this are freed when they become empty */
+	const size_t MAX_IDLE_CAPACITY = 4096;
+
+	/** Buffers and results of the operations of a socket whose I/O is submitted to the ring.
+	 * This is allocated separately from FdState because the kernel accesses it while
+	 * operations are in flight, so it must not move when the state table grows.
+	 */
+	struct RingIO
+	{
+		/** Receive buffer holding data that Recv() has not returned yet, -1 if none */
+		int bufid;
+
+		/** Offset of the data in the receive buffer which Recv() returns next */
+		unsigned int recvpos;
+
+		/** Length of the data in the receive buffer */
+		unsigned int recvlen;
+
+		/** True if a recv completed with end of file */
+		bool eof;
+
+		/** Data handed to the kernel by the send in flight */
+		std::string sending;
+
+		/** Data written while a send was in flight, sent when it completes */
+		std::string unsent;
+
+		/** Connection returned by an accept which Accept() has not returned yet, -1 if none */
+		int accepted;
+
+		/** Address of the accepted connection, filled in by the kernel */
+		irc::sockets::sockaddrs addr;
+		socklen_t addrlen;
+
+		RingIO() : bufid(-1), recvpos(0), recvlen(0), eof(false), accepted(-1), addrlen(0) { }
+	};
+
+	/** Per-descriptor state of the engine */
+	struct FdState
+	{
+		/** Incremented when the fd is removed from the engine, completions of operations
+		 * on the previous socket using the fd carry an older generation and are stale.
+		 */
+		unsigned int gen;
+
+		/** Incremented every time the poll request for this fd is replaced or removed,
+		 * poll completions carrying an older generation are stale and ignored.
+		 */
+		unsigned int pollgen;
+
+		/** Poll events of the request currently armed in the kernel, 0 if none */
+		unsigned int armed;
+
+		/** Bit (1 << OpKind) is set for each recv, send or accept operation in flight */
+		unsigned int inflight;
+
+		/** True if the fd is on the dirty list */
+		bool dirty;
+
+		/** Buffers of the operations submitted to the ring, NULL if none were used yet */
+		RingIO* io;
+
+		FdState() : gen(0), pollgen(0), armed(0), inflight(0), dirty(false), io(NULL) { }
+	};
+
+	int EngineHandle = -1;
+	unsigned int Features;
+
+	/** Submission ring */
+	unsigned int* sq_head;
+	unsigned int* sq_tail;
+	unsigned int sq_mask;
+	unsigned int sq_entries;
+	unsigned int* sq_array;
+	io_uring_sqe* sqes;
+
+	/** Local copy of the submission tail, published to the kernel in Submit() */
+	unsigned int sqe_tail;
+
+	/** Completion ring */
+	unsigned int* cq_head;
+	unsigned int* cq_tail;
+	unsigned int cq_mask;
+	io_uring_cqe* cqes;
+
+	/** Mappings of the rings, kept to be able to unmap them */
+	void* sq_ptr;
+	size_t sq_ptr_size;
+	void* cq_ptr;
+	size_t cq_ptr_size;
+	size_t sqes_size;
+
+	/** True if a fallback timeout operation is in flight */
+	bool timeout_pending;
+	__kernel_timespec timeout_ts;
+
+	/** Whether the kernel supports the operations needed to submit socket I/O to the ring */
+	enum
+	{
+		RING_IO_UNKNOWN,
+		RING_IO_AVAILABLE,
+		RING_IO_UNAVAILABLE
+	} ring_io;
+
+	/** Storage of the receive buffers, the buffer with id N starts at N * recvbuffer_size */
+	std::vector<char> recvbuffers;
+	unsigned int recvbuffer_size;
+
+	/** Receive buffers whose data has been consumed, they are given back to the kernel before the next wait */
+	std::vector<unsigned int> spare_buffers;
+
+	/** State for each fd, indexed by fd */
+	std::vector<FdState> fdstate(16);
+
+	/** Fds whose operations must be brought up to date before waiting */
+	std::vector<int> dirty;
+
+	/** Completions reaped by the current DispatchEvents() call */
+	std::vector<io_uring_cqe> completions;
+
+	/** Index of the first completion in completions which has not been dispatched yet */
+	size_t dispatch_next;
+
+	/** Completions taken out of the ring to make room for submissions, dispatched by the next DispatchEvents() call */
+	std::vector<io_uring_cqe> reaped;
+
+	int io_uring_setup(unsigned int entries, io_uring_params* params)
+	{
+		return syscall(__NR_io_uring_setup, entries, params);
+	}
+
+	int io_uring_enter(unsigned int to_submit, unsigned int min_complete, unsigned int flags, const void* arg, size_t argsz)
+	{
+		return syscall(__NR_io_uring_enter, EngineHandle, to_submit, min_complete, flags, arg, argsz);
+	}
+
+	inline __u64 MakeUserData(int fd, unsigned int gen, OpKind kind)
+	{
+		return (static_cast<__u64>(gen) << 32) | (static_cast<__u64>(kind) << FD_BITS) | static_cast<unsigned int>(fd);
+	}
+
+	inline int GetUserDataFd(__u64 user_data)
+	{
+		return static_cast<int>(user_data & ((1U << FD_BITS) - 1));
+	}
+
+	inline OpKind GetUserDataKind(__u64 user_data)
+	{
+		return static_cast<OpKind>((user_data >> FD_BITS) & 3);
+	}
+
+	inline unsigned int GetUserDataGen(__u64 user_data)
+	{
+		return static_cast<unsigned int>(user_data >> 32);
+	}
+
+	/** Number of queued submissions the kernel has not consumed yet */
+	inline unsigned int PendingSubmissions()
+	{
+		return sqe_tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+	}
+
+	/** Move all completions out of the completion ring
+	 * @param out The completions are appended to this
+	 */
+	void Reap(std::vector<io_uring_cqe>& out)
+	{
+		unsigned int head = *cq_head;
+		const unsigned int tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+		for (; head != tail; head++)
+			out.push_back(cqes[head & cq_mask]);
+		__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+	}
+
+	/** Hand all queued submissions to the kernel without waiting for completions
+	 * @return True if the kernel consumed all of them
+	 */
+	bool Submit()
+	{
+		__atomic_store_n(sq_tail, sqe_tail, __ATOMIC_RELEASE);
+		bool retried = false;
+		for (unsigned int pending = PendingSubmissions(); pending; pending = PendingSubmissions())
+		{
+			int ret = io_uring_enter(pending, 0, 0, NULL, 0);
+			if (ret > 0 || (ret < 0 && errno == EINTR))
+				continue;
+
+			// EBUSY means the kernel can't post more completions until some are reaped, EAGAIN that it
+			// is short on memory. Take the completions out of the ring and try once more.
+			if (!retried)
+			{
+				retried = true;
+				Reap(reaped);
+				continue;
+			}
+
+			ServerInstance->Logs->Log("SOCKET", LOG_DEFAULT, "io_uring_enter() failed to submit %u operations: %s", pending, ret < 0 ? strerror(errno) : "none consumed");
+			return false;
+		}
+		return true;
+	}
+
+	/** Hand all queued submissions to the kernel and wait for at least one completion
+	 * @param out The completions are appended to this
+	 * @return False if waiting failed
+	 */
+	bool SubmitAndWait(std::vector<io_uring_cqe>& out)
+	{
+		__atomic_store_n(sq_tail, sqe_tail, __ATOMIC_RELEASE);
+		int ret = io_uring_enter(PendingSubmissions(), 1, IORING_ENTER_GETEVENTS, NULL, 0);
+		if (ret < 0 && errno != EINTR)
+		{
+			ServerInstance->Logs->Log("SOCKET", LOG_DEFAULT, "io_uring_enter() failed to wait for completions: %s", strerror(errno));
+			return false;
+		}
+		Reap(out);
+		return true;
+	}
+
+	/** Get a cleared submission queue entry, submitting the queue to make room if it is full
+	 * @return The entry, or NULL if the queue is full and could not be submitted
+	 */
+	io_uring_sqe* GetSQE()
+	{
+		if (PendingSubmissions() >= sq_entries)
+		{
+			Submit();
+			// A slot the kernel has not consumed yet must not be overwritten
+			if (PendingSubmissions() >= sq_entries)
+				return NULL;
+		}
+
+		unsigned int index = sqe_tail & sq_mask;
+		io_uring_sqe* sqe = &sqes[index];
+		memset(sqe, 0, sizeof(*sqe));
+		sq_array[index] = index;
+		sqe_tail++;
+		return sqe;
+	}
+
+	bool QueuePollAdd(int fd, unsigned int events, __u64 user_data)
+	{
+		io_uring_sqe* sqe = GetSQE();
+		if (!sqe)
+			return false;
+
+		sqe->opcode = IORING_OP_POLL_ADD;
+		sqe->fd = fd;
+#if __BYTE_ORDER == __BIG_ENDIAN
+		events = (events << 16) | (events >> 16);
+#endif
+		sqe->poll32_events = events;
+		sqe->user_data = user_data;
+		return true;
+	}
+
+	bool QueuePollRemove(__u64 target)
+	{
+		io_uring_sqe* sqe = GetSQE();
+		if (!sqe)
+			return false;
+
+		sqe->opcode = IORING_OP_POLL_REMOVE;
+		sqe->fd = -1;
+		sqe->addr = target;
+		sqe->user_data = IGNORE_TAG;
+		return true;
+	}
+
+	bool QueueCancel(__u64 target)
+	{
+		io_uring_sqe* sqe = GetSQE();
+		if (!sqe)
+			return false;
+
+		sqe->opcode = IORING_OP_ASYNC_CANCEL;
+		sqe->fd = -1;
+		sqe->addr = target;
+		sqe->user_data = IGNORE_TAG;
+		return true;
+	}
+
+	/** Give receive buffers to the kernel which recvs can pick from
+	 * @param first Id of the first buffer
+	 * @param count Number of consecutive buffers
+	 */
+	bool QueueProvideBuffers(unsigned int first, unsigned int count, __u64 user_data)
+	{
+		io_uring_sqe* sqe = GetSQE();
+		if (!sqe)
+			return false;
+
+		sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+		sqe->fd = count;
+		sqe->addr = reinterpret_cast<__u64>(&recvbuffers[first * recvbuffer_size]);
+		sqe->len = recvbuffer_size;
+		sqe->off = first;
+		sqe->buf_group = RECV_BUFFER_GROUP;
+		sqe->user_data = user_data;
+		return true;
+	}
+
+	FdState& GetState(int fd)
+	{
+		while (static_cast<unsigned int>(fd) >= fdstate.size())
+			fdstate.resize(fdstate.size() * 2);
+		return fdstate[fd];
+	}
+
+	/** Get the state of a fd without growing the table
+	 * @return The state, or NULL if the fd was never added
+	 */
+	FdState* FindState(int fd)
+	{
+		if (fd < 0 || static_cast<unsigned int>(fd) >= fdstate.size())
+			return NULL;
+		return &fdstate[fd];
+	}
+
+	RingIO* GetIO(FdState& state)
+	{
+		if (!state.io)
+			state.io = new RingIO;
+		return state.io;
+	}
+
+	void MarkDirty(int fd)
+	{
+		FdState& state = GetState(fd);
+		if (!state.dirty)
+		{
+			state.dirty = true;
+			dirty.push_back(fd);
+		}
+	}
+
+	IOMode GetMode(EventHandler* eh)
+	{
+		if (ring_io != RING_IO_AVAILABLE)
+			return MODE_POLL;
+		if (dynamic_cast<ListenSocket*>(eh))
+			return MODE_LISTEN;
+		// An IOHook reads and writes the fd itself
+		StreamSocket* const sock = dynamic_cast<StreamSocket*>(eh);
+		if (sock && !sock->GetIOHook())
+			return MODE_STREAM;
+		return MODE_POLL;
+	}
+
+	/** Get the buffers of a handler whose writes are sent through the ring
+	 * @return The buffers, or NULL if the handler writes to the fd itself
+	 */
+	RingIO* GetSendIO(EventHandler* eh)
+	{
+		const int fd = eh->GetFd();
+		if (SocketEngine::GetRef(fd) != eh || (eh->GetEventMask() & FD_DETACHED))
+			return NULL;
+
+		FdState& state = GetState(fd);
+		// Data which is still waiting in the engine must go out first
+		if (state.io && (!state.io->sending.empty() || !state.io->unsent.empty()))
+			return state.io;
+		if (GetMode(eh) != MODE_STREAM)
+			return NULL;
+		return GetIO(state);
+	}
+
+	/** Append data to the unsent buffer of a socket, as much as fits
+	 * @return The number of bytes taken, or -1 with errno set to EAGAIN if none fit
+	 */
+	int QueueWrite(int fd, RingIO* io, const iovec* iov, int iovcnt)
+	{
+		const size_t queued = io->sending.size() + io->unsent.size();
+		if (queued >= MAX_UNSENT)
+		{
+			errno = EAGAIN;
+			return -1;
+		}
+
+		size_t room = MAX_UNSENT - queued;
+		size_t total = 0;
+		for (int i = 0; i < iovcnt && room; i++)
+		{
+			const size_t len = std::min(room, iov[i].iov_len);
+			io->unsent.append(static_cast<const char*>(iov[i].iov_base), len);
+			room -= len;
+			total += len;
+		}
+
+		// The send is queued right before the next wait, together with everything else written until then
+		MarkDirty(fd);
+		return total;
+	}
+
+	void ReleaseBuffer(int bufid)
+	{
+		spare_buffers.push_back(bufid);
+	}
+
+	/** Free what a completion which is not going to be dispatched holds */
+	void Discard(const io_uring_cqe& cqe)
+	{
+		if (cqe.flags & IORING_CQE_F_BUFFER)
+			ReleaseBuffer(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+		if (GetUserDataKind(cqe.user_data) == OP_ACCEPT && cqe.res >= 0)
+			SocketEngine::Close(cqe.res);
+	}
+
+	bool IsStale(const io_uring_cqe& cqe, const FdState& state)
+	{
+		const unsigned int gen = GetUserDataGen(cqe.user_data);
+		return GetUserDataKind(cqe.user_data) == OP_POLL ? gen != state.pollgen : gen != state.gen;
+	}
+
+	/** Take the completions of the operations on a fd out of a list so they are not dispatched */
+	void RetireCompletions(int fd, FdState& state, std::vector<io_uring_cqe>& list, size_t first)
+	{
+		for (size_t i = first; i < list.size(); i++)
+		{
+			io_uring_cqe& cqe = list[i];
+			if (cqe.user_data >= PROVIDE_TAG || GetUserDataFd(cqe.user_data) != fd || IsStale(cqe, state))
+				continue;
+
+			const OpKind kind = GetUserDataKind(cqe.user_data);
+			if (kind == OP_POLL)
+				state.armed = 0;
+			else
+				state.inflight &= ~(1U << kind);
+			Discard(cqe);
+			cqe.user_data = IGNORE_TAG;
+		}
+	}
+
+	/** Cancel the operations on a fd which is removed from the engine and free its buffers.
+	 * The kernel uses the buffers until the operations complete, so this waits for that.
+	 */
+	void CancelRingIO(int fd, FdState& state)
+	{
+		// Completions which arrived but were not dispatched yet must not reach the next socket using this fd
+		RetireCompletions(fd, state, completions, dispatch_next);
+		RetireCompletions(fd, state, reaped, 0);
+
+		RingIO* const io = state.io;
+		if (io && !(state.inflight & (1U << OP_SEND)) && (!io->sending.empty() || !io->unsent.empty()))
+		{
+			// Nothing has been handed to the kernel since the last wait, so send what was written
+			// since then now, like an engine whose handlers write to the fd themselves would have done
+			iovec iov[2];
+			iov[0].iov_base = const_cast<char*>(io->sending.data());
+			iov[0].iov_len = io->sending.size();
+			iov[1].iov_base = const_cast<char*>(io->unsent.data());
+			iov[1].iov_len = io->unsent.size();
+			if (writev(fd, iov, 2) < 0)
+				ServerInstance->Logs->Log("SOCKET", LOG_DEBUG, "Could not send the remaining data of fd %d: %s", fd, strerror(errno));
+		}
+
+		bool cancelled = true;
+		for (unsigned int kind = OP_RECV; kind <= OP_ACCEPT; kind++)
+		{
+			if ((state.inflight & (1U << kind)) && !QueueCancel(MakeUserData(fd, state.gen, static_cast<OpKind>(kind))))
+				cancelled = false;
+		}
+
+		std::vector<io_uring_cqe> out;
+		while (cancelled && state.inflight && SubmitAndWait(out))
+		{
+			for (std::vector<io_uring_cqe>::const_iterator i = out.begin(); i != out.end(); ++i)
+				reaped.push_back(*i);
+			out.clear();
+			RetireCompletions(fd, state, reaped, 0);
+		}
+
+		if (state.inflight)
+		{
+			// The kernel may still write into the buffers, so they can't be freed or reused
+			ServerInstance->Logs->Log("SOCKET", LOG_DEFAULT, "Could not cancel the operations of fd %d, leaking their buffers", fd);
+			state.inflight = 0;
+			state.io = NULL;
+			return;
+		}
+
+		if (io)
+		{
+			if (io->bufid >= 0)
+				ReleaseBuffer(io->bufid);
+			if (io->accepted >= 0)
+				SocketEngine::Close(io->accepted);
+			delete io;
+			state.io = NULL;
+		}
+	}
+
+	void UnmapRings()
+	{
+		if (sqes)
+			munmap(sqes, sqes_size);
+		if (cq_ptr && cq_ptr != sq_ptr)
+			munmap(cq_ptr, cq_ptr_size);
+		if (sq_ptr)
+			munmap(sq_ptr, sq_ptr_size);
+		sqes = NULL;
+		sq_ptr = cq_ptr = NULL;
+	}
+
+	bool SetupRing()
+	{
+		io_uring_params params;
+		for (unsigned int entries = 4096; entries >= 64; entries /= 2)
+		{
+			memset(&params, 0, sizeof(params));
+			EngineHandle = io_uring_setup(entries, &params);
+			if (EngineHandle >= 0 || errno != ENOMEM)
+				break;
+		}
+
+		if (EngineHandle < 0)
+			return false;
+
+		Features = params.features;
+		sq_ptr_size = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+		cq_ptr_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		if (Features & IORING_FEAT_SINGLE_MMAP)
+			sq_ptr_size = cq_ptr_size = std::max(sq_ptr_size, cq_ptr_size);
+
+		sq_ptr = mmap(NULL, sq_ptr_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, EngineHandle, IORING_OFF_SQ_RING);
+		if (sq_ptr == MAP_FAILED)
+		{
+			sq_ptr = NULL;
+			return false;
+		}
+
+		if (Features & IORING_FEAT_SINGLE_MMAP)
+			cq_ptr = sq_ptr;
+		else
+		{
+			cq_ptr = mmap(NULL, cq_ptr_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, EngineHandle, IORING_OFF_CQ_RING);
+			if (cq_ptr == MAP_FAILED)
+			{
+				cq_ptr = NULL;
+				return false;
+			}
+		}
+
+		sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+		sqes = static_cast<io_uring_sqe*>(mmap(NULL, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, EngineHandle, IORING_OFF_SQES));
+		if (sqes == MAP_FAILED)
+		{
+			sqes = NULL;
+			return false;
+		}
+
+		char* sq = static_cast<char*>(sq_ptr);
+		sq_head = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+		sq_tail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+		sq_mask = *reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+		sq_entries = *reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_entries);
+		sq_array = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+		sqe_tail = *sq_tail;
+
+		char* cq = static_cast<char*>(cq_ptr);
+		cq_head = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+		cq_tail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+		cq_mask = *reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+		cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+		timeout_pending = false;
+		ring_io = RING_IO_UNKNOWN;
+		spare_buffers.clear();
+		return true;
+	}
+
+	/** Provide the receive buffers to the kernel. If the kernel can't take them (before Linux 5.7)
+	 * every handler is left to do its own I/O.
+	 */
+	void SetupRingIO()
+	{
+		ring_io = RING_IO_UNAVAILABLE;
+		recvbuffer_size = ServerInstance->Config->NetBufferSize;
+		recvbuffers.resize(RECV_BUFFER_COUNT * recvbuffer_size);
+		if (!QueueProvideBuffers(0, RECV_BUFFER_COUNT, PROVIDE_TAG))
+			return;
+
+		std::vector<io_uring_cqe> out;
+		while (SubmitAndWait(out))
+		{
+			for (std::vector<io_uring_cqe>::const_iterator i = out.begin(); i != out.end(); ++i)
+			{
+				if (i->user_data != PROVIDE_TAG)
+				{
+					reaped.push_back(*i);
+					continue;
+				}
+
+				if (i->res < 0)
+				{
+					ServerInstance->Logs->Log("SOCKET", LOG_DEFAULT, "The kernel does not support providing buffers to io_uring (%s), socket I/O is not submitted to the ring", strerror(-i->res));
+					recvbuffers.clear();
+					return;
+				}
+
+				ring_io = RING_IO_AVAILABLE;
+				return;
+			}
+			out.clear();
+		}
+	}
+
+	/** Queue the operations a fd needs for the event mask of its handler
+	 * @return False if the submission queue is full, the fd must be updated again later
+	 */
+	bool UpdateFd(int fd, FdState& state)
+	{
+		EventHandler* eh = SocketEngine::GetRef(fd);
+		unsigned int want = 0;
+		if (eh && !(eh->GetEventMask() & FD_DETACHED))
+		{
+			const int event_mask = eh->GetEventMask();
+			const bool want_read = event_mask & (FD_WANT_POLL_READ | FD_WANT_FAST_READ);
+			const bool want_write = event_mask & (FD_WANT_POLL_WRITE | FD_WANT_FAST_WRITE | FD_WANT_SINGLE_WRITE);
+			const IOMode mode = GetMode(eh);
+			if (mode == MODE_POLL)
+			{
+				if (want_read)
+					want |= POLLIN;
+				if (want_write)
+					want |= POLLOUT;
+			}
+			else if (mode == MODE_LISTEN)
+			{
+				RingIO* const io = GetIO(state);
+				if (want_read && !(state.inflight & (1U << OP_ACCEPT)) && io->accepted < 0)
+				{
+					io_uring_sqe* sqe = GetSQE();
+					if (!sqe)
+						return false;
+
+					io->addrlen = sizeof(io->addr);
+					sqe->opcode = IORING_OP_ACCEPT;
+					sqe->fd = fd;
+					sqe->addr = reinterpret_cast<__u64>(&io->addr);
+					sqe->addr2 = reinterpret_cast<__u64>(&io->addrlen);
+					sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+					sqe->user_data = MakeUserData(fd, state.gen, OP_ACCEPT);
+					state.inflight |= 1U << OP_ACCEPT;
+				}
+			}
+			else
+			{
+				RingIO* const io = GetIO(state);
+				if (want_read && !(state.inflight & (1U << OP_RECV)) && io->bufid < 0 && !io->eof)
+				{
+					io_uring_sqe* sqe = GetSQE();
+					if (!sqe)
+						return false;
+
+					sqe->opcode = IORING_OP_RECV;
+					sqe->fd = fd;
+					sqe->len = recvbuffer_size;
+					sqe->flags = IOSQE_BUFFER_SELECT;
+					sqe->buf_group = RECV_BUFFER_GROUP;
+					sqe->user_data = MakeUserData(fd, state.gen, OP_RECV);
+					state.inflight |= 1U << OP_RECV;
+				}
+
+				if (!(state.inflight & (1U << OP_SEND)))
+				{
+					if (io->sending.empty())
+						io->sending.swap(io->unsent);
+					if (!io->sending.empty())
+					{
+						io_uring_sqe* sqe = GetSQE();
+						if (!sqe)
+							return false;
+
+						sqe->opcode = IORING_OP_SEND;
+						sqe->fd = fd;
+						sqe->addr = reinterpret_cast<__u64>(io->sending.data());
+						sqe->len = io->sending.size();
+						sqe->user_data = MakeUserData(fd, state.gen, OP_SEND);
+						state.inflight |= 1U << OP_SEND;
+					}
+				}
+
+				// The completion of a send is the write event; only poll if nothing is being sent, e.g. during connect()
+				if (want_write && !(state.inflight & (1U << OP_SEND)))
+					want |= POLLOUT;
+			}
+		}
+
+		if (want == state.armed)
+			return true;
+
+		if (state.armed)
+		{
+			if (!QueuePollRemove(MakeUserData(fd, state.pollgen, OP_POLL)))
+				return false;
+			state.pollgen++;
+			state.armed = 0;
+		}
+
+		if (want)
+		{
+			if (!QueuePollAdd(fd, want, MakeUserData(fd, state.pollgen, OP_POLL)))
+				return false;
+			state.armed = want;
+		}
+		return true;
+	}
+
+	/** Bring the operations in the kernel in line with the event masks of the dirty fds */
+	void FlushChanges()
+	{
+		if (ring_io == RING_IO_UNKNOWN)
+			SetupRingIO();
+
+		while (!spare_buffers.empty() && QueueProvideBuffers(spare_buffers.back(), 1, IGNORE_TAG))
+			spare_buffers.pop_back();
+
+		// Fds whose change could not be queued are put back on the dirty list and retried in the next iteration
+		static std::vector<int> working_list;
+		working_list.swap(dirty);
+		for (std::vector<int>::const_iterator i = working_list.begin(); i != working_list.end(); ++i)
+		{
+			const int fd = *i;
+			FdState& state = fdstate[fd];
+			state.dirty = false;
+			if (!UpdateFd(fd, state))
+				MarkDirty(fd);
+		}
+		working_list.clear();
+	}
+}
+
+void SocketEngine::Init()
+{
+	struct rlimit limits;
+	if (!getrlimit(RLIMIT_NOFILE, &limits))
+	{
+		MAX_DESCRIPTORS = limits.rlim_cur;
+	}
+	else
+	{
+		// MAX_DESCRIPTORS is mainly used for display purposes, it's not a problem that getrlimit() failed
+		MAX_DESCRIPTORS = -1;
+	}
+
+	RecoverFromFork();
+}
+
+void SocketEngine::RecoverFromFork()
+{
+	// The ring is shared with the process we forked from, so set up a private one. No operations
+	// have been submitted at this point, so nothing has to be carried over.
+	if (EngineHandle >= 0)
+	{
+		UnmapRings();
+		Close(EngineHandle);
+		EngineHandle = -1;
+	}
+
+	if (!SetupRing())
+	{
+		ServerInstance->Logs->Log("SOCKET", LOG_DEFAULT, "ERROR: Could not initialize socket engine: %s", strerror(errno));
+		ServerInstance->Logs->Log("SOCKET", LOG_DEFAULT, "ERROR: Your kernel probably does not have the proper features. This is a fatal error, exiting now.");
+		std::cout << "ERROR: Could not initialize io_uring socket engine: " << strerror(errno) << std::endl;
+		std::cout << "ERROR: Your kernel probably does not have the proper features. This is a fatal error, exiting now." << std::endl;
+		ServerInstance->QuickExit(EXIT_STATUS_SOCKETENGINE);
+	}
+}
+
+void SocketEngine::Deinit()
+{
+	UnmapRings();
+	Close(EngineHandle);
+	EngineHandle = -1;
+}
+
+bool SocketEngine::AddFd(EventHandler* eh, int event_mask)
+{
+	int fd = eh->GetFd();
+	if (fd < 0 || static_cast<unsigned int>(fd) >> FD_BITS)
+	{
+		ServerInstance->Logs->Log("SOCKET", LOG_DEBUG, "AddFd out of range: (fd: %d)", fd);
+		return false;
+	}
+
+	if (!SocketEngine::AddFdRef(eh))
+	{
+		ServerInstance->Logs->Log("SOCKET", LOG_DEBUG, "Attempt to add duplicate fd: %d", fd);
+		return false;
+	}
+
+	ServerInstance->Logs->Log("SOCKET", LOG_DEBUG, "New file descriptor: %d", fd);
+
+	eh->SetEventMask(event_mask);
+	MarkDirty(fd);
+	return true;
+}
+
+void SocketEngine::OnSetEvent(EventHandler* eh, int old_mask, int new_mask)
+{
+	// The operations are brought up to date right before the next wait, so a mask that flips
+	// back and forth during one iteration costs nothing.
+	if (eh->GetFd() >= 0)
+		MarkDirty(eh->GetFd());
+}
+
+void SocketEngine::DelFd(EventHandler* eh)
+{
+	int fd = eh->GetFd();
+	if (fd < 0)
+	{
+		ServerInstance->Logs->Log("SOCKET", LOG_DEBUG, "DelFd out of range: (fd: %d)", fd);
+		return;
+	}
+
+	// Operations hold a reference to the file, which would keep the connection open after
+	// the caller closes the fd, so their removal has to reach the kernel right away.
+	FdState& state = GetState(fd);
+	if (state.armed)
+	{
+		if (!QueuePollRemove(MakeUserData(fd, state.pollgen, OP_POLL)))
+			ServerInstance->Logs->Log("SOCKET", LOG_DEFAULT, "Could not remove the poll request of fd %d, the connection stays open until it completes", fd);
+		state.armed = 0;
+	}
+
+	if (state.inflight || state.io)
+		CancelRingIO(fd, state);
+	else if (!Submit())
+		ServerInstance->Logs->Log("SOCKET", LOG_DEFAULT, "Could not remove the poll request of fd %d, the connection stays open until it completes", fd);
+	state.gen++;
+	state.pollgen++;
+
+	SocketEngine::DelFdRef(eh);
+
+	ServerInstance->Logs->Log("SOCKET", LOG_DEBUG, "Remove file descriptor: %d", fd);
+}
+
+int SocketEngine::Accept(EventHandler* fd, sockaddr *addr, socklen_t *addrlen)
+{
+	FdState* const state = FindState(fd->GetFd());
+	RingIO* const io = state ? state->io : NULL;
+	if (io && io->accepted >= 0)
+	{
+		const int newfd = io->accepted;
+		io->accepted = -1;
+		memcpy(addr, &io->addr, std::min(*addrlen, io->addrlen));
+		*addrlen = io->addrlen;
+		return newfd;
+	}
+
+	if (state && (state->inflight & (1U << OP_ACCEPT)))
+	{
+		errno = EAGAIN;
+		return -1;
+	}
+	return accept4(fd->GetFd(), addr, addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+}
+
+int SocketEngine::Recv(EventHandler* fd, void *buf, size_t len, int flags)
+{
+	FdState* const state = FindState(fd->GetFd());
+	RingIO* const io = state ? state->io : NULL;
+	if (io && io->bufid >= 0)
+	{
+		const size_t nbRecvd = std::min<size_t>(len, io->recvlen - io->recvpos);
+		memcpy(buf, &recvbuffers[io->bufid * recvbuffer_size + io->recvpos], nbRecvd);
+		io->recvpos += nbRecvd;
+		if (io->recvpos == io->recvlen)
+		{
+			ReleaseBuffer(io->bufid);
+			io->bufid = -1;
+		}
+		stats.Update(nbRecvd, 0);
+		return nbRecvd;
+	}
+
+	if (io && io->eof)
+		return 0;
+
+	if (state && (state->inflight & (1U << OP_RECV)))
+	{
+		errno = EAGAIN;
+		return -1;
+	}
+
+	int nbRecvd = recv(fd->GetFd(), (char*)buf, len, flags);
+	if (nbRecvd > 0)
+		stats.Update(nbRecvd, 0);
+	return nbRecvd;
+}
+
+int SocketEngine::Send(EventHandler* fd, const void *buf, size_t len, int flags)
+{
+	RingIO* const io = GetSendIO(fd);
+	if (io)
+	{
+		iovec iov;
+		iov.iov_base = const_cast<void*>(buf);
+		iov.iov_len = len;
+		int nbSent = QueueWrite(fd->GetFd(), io, &iov, 1);
+		if (nbSent > 0)
+			stats.Update(0, nbSent);
+		return nbSent;
+	}
+
+	int nbSent = send(fd->GetFd(), (const char*)buf, len, flags);
+	if (nbSent > 0)
+		stats.Update(0, nbSent);
+	return nbSent;
+}
+
+int SocketEngine::WriteV(EventHandler* fd, const iovec* iov, int iovcnt)
+{
+	RingIO* const io = GetSendIO(fd);
+	int nbSent = io ? QueueWrite(fd->GetFd(), io, iov, iovcnt) : writev(fd->GetFd(), iov, iovcnt);
+	if (nbSent > 0)
+		stats.Update(0, nbSent);
+	return nbSent;
+}
+
+int SocketEngine::DispatchEvents()
+{
+	FlushChanges();
+
+	unsigned int flags = 0;
+	unsigned int min_complete = 0;
+	const void* arg = NULL;
+	size_t argsz = 0;
+#ifdef IORING_FEAT_EXT_ARG
+	io_uring_getevents_arg getevents;
+#endif
+
+	// Only block if there is nothing left to reap from the previous call
+	if (reaped.empty() && __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE) == *cq_head)
+	{
+		flags |= IORING_ENTER_GETEVENTS;
+		min_complete = 1;
+		const int timeout = GetDispatchTimeout();
+		timeout_ts.tv_sec = timeout / 1000;
+		timeout_ts.tv_nsec = (timeout % 1000) * 1000000;
+
+#ifdef IORING_FEAT_EXT_ARG
+		if (Features & IORING_FEAT_EXT_ARG)
+		{
+			memset(&getevents, 0, sizeof(getevents));
+			getevents.sigmask_sz = _NSIG / 8;
+			getevents.ts = reinterpret_cast<__u64>(&timeout_ts);
+			flags |= IORING_ENTER_EXT_ARG;
+			arg = &getevents;
+			argsz = sizeof(getevents);
+		}
+		else
+#endif
+		if (!timeout_pending)
+		{
+			io_uring_sqe* sqe = GetSQE();
+			if (sqe)
+			{
+				sqe->opcode = IORING_OP_TIMEOUT;
+				sqe->addr = reinterpret_cast<__u64>(&timeout_ts);
+				sqe->len = 1;
+				sqe->user_data = TIMEOUT_TAG;
+				timeout_pending = true;
+			}
+			else
+			{
+				// Without a timeout the wait could outlast the next timer, so don't wait at all
+				flags &= ~IORING_ENTER_GETEVENTS;
+				min_complete = 0;
+			}
+		}
+	}
+
+	__atomic_store_n(sq_tail, sqe_tail, __ATOMIC_RELEASE);
+	int ret = io_uring_enter(PendingSubmissions(), min_complete, flags, arg, argsz);
+	if (ret < 0 && errno != EINTR && errno != ETIME && errno != EBUSY)
+		ServerInstance->Logs->Log("SOCKET", LOG_DEBUG, "io_uring_enter() failed: %s", strerror(errno));
+
+	ServerInstance->UpdateTime();
+
+	// Copy the completions out of the ring before dispatching them so that handlers
+	// which add or remove fds cannot disturb the iteration
+	completions.clear();
+	completions.swap(reaped);
+	Reap(completions);
+
+	int events = 0;
+	for (dispatch_next = 0; dispatch_next < completions.size(); )
+	{
+		// DelFd() retires the completions after dispatch_next which belong to the fd it removes
+		const io_uring_cqe cqe = completions[dispatch_next++];
+		if (cqe.user_data == TIMEOUT_TAG)
+		{
+			timeout_pending = false;
+			continue;
+		}
+
+		if (cqe.user_data >= PROVIDE_TAG)
+			continue;
+
+		const int fd = GetUserDataFd(cqe.user_data);
+		const OpKind kind = GetUserDataKind(cqe.user_data);
+		if (static_cast<unsigned int>(fd) >= fdstate.size() || IsStale(cqe, fdstate[fd]))
+		{
+			// Completion of a request that was replaced or removed
+			Discard(cqe);
+			continue;
+		}
+
+		// The operations are one-shot, queue them to be submitted again with whatever the handler wants after this event
+		FdState& state = fdstate[fd];
+		if (kind == OP_POLL)
+			state.armed = 0;
+		else
+			state.inflight &= ~(1U << kind);
+		MarkDirty(fd);
+
+		EventHandler* const eh = GetRef(fd);
+		if (!eh)
+		{
+			Discard(cqe);
+			continue;
+		}
+
+		RingIO* const io = state.io;
+		if (kind == OP_RECV)
+		{
+			if (cqe.flags & IORING_CQE_F_BUFFER)
+			{
+				const int bufid = cqe.flags >> IORING_CQE_BUFFER_SHIFT;
+				if (cqe.res > 0)
+				{
+					io->bufid = bufid;
+					io->recvpos = 0;
+					io->recvlen = cqe.res;
+				}
+				else
+					ReleaseBuffer(bufid);
+			}
+
+			if (cqe.res == -EAGAIN || cqe.res == -EINTR)
+				continue;
+
+			events++;
+			stats.TotalEvents++;
+
+			// If all receive buffers were in use (ENOBUFS) the handler's Recv() reads from the socket itself
+			if (cqe.res < 0 && cqe.res != -ENOBUFS)
+			{
+				stats.ErrorEvents++;
+				eh->HandleEvent(EVENT_ERROR, -cqe.res);
+				continue;
+			}
+
+			if (cqe.res == 0)
+				io->eof = true;
+
+			eh->SetEventMask(eh->GetEventMask() & ~FD_READ_WILL_BLOCK);
+			stats.ReadEvents++;
+			eh->HandleEvent(EVENT_READ);
+			continue;
+		}
+
+		if (kind == OP_SEND)
+		{
+			if (cqe.res >= 0)
+			{
+				io->sending.erase(0, cqe.res);
+				if (io->sending.empty() && io->unsent.empty() && io->sending.capacity() > MAX_IDLE_CAPACITY)
+					std::string().swap(io->sending);
+			}
+			else if (cqe.res != -EAGAIN && cqe.res != -EINTR)
+			{
+				io->sending.clear();
+				io->unsent.clear();
+				events++;
+				stats.TotalEvents++;
+				stats.ErrorEvents++;
+				eh->HandleEvent(EVENT_ERROR, -cqe.res);
+				continue;
+			}
+
+			// Handlers which were told that writes would block get a write event once there is room again
+			int mask = eh->GetEventMask();
+			if (!(mask & (FD_WANT_POLL_WRITE | FD_WANT_FAST_WRITE | FD_WANT_SINGLE_WRITE)) || io->sending.size() + io->unsent.size() >= MAX_UNSENT)
+				continue;
+
+			events++;
+			stats.TotalEvents++;
+			eh->SetEventMask(mask & ~(FD_WRITE_WILL_BLOCK | FD_WANT_SINGLE_WRITE));
+			stats.WriteEvents++;
+			eh->HandleEvent(EVENT_WRITE);
+			continue;
+		}
+
+		if (kind == OP_ACCEPT)
+		{
+			if (cqe.res == -EAGAIN || cqe.res == -EINTR)
+				continue;
+
+			// Errors such as EMFILE are reported by the accept() the handler does itself
+			if (cqe.res >= 0)
+				io->accepted = cqe.res;
+
+			events++;
+			stats.TotalEvents++;
+			stats.ReadEvents++;
+			eh->HandleEvent(EVENT_READ);
+			continue;
+		}
+
+		events++;
+		stats.TotalEvents++;
+
+		if (cqe.res < 0)
+		{
+			stats.ErrorEvents++;
+			eh->HandleEvent(EVENT_ERROR, -cqe.res);
+			continue;
+		}
+
+		const unsigned int revents = cqe.res;
+		if (revents & POLLHUP)
+		{
+			stats.ErrorEvents++;
+			eh->HandleEvent(EVENT_ERROR, 0);
+			continue;
+		}
+
+		if (revents & POLLERR)
+		{
+			stats.ErrorEvents++;
+			/* Get error number */
+			socklen_t codesize = sizeof(int);
+			int errcode;
+			if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &errcode, &codesize) < 0)
+				errcode = errno;
+			eh->HandleEvent(EVENT_ERROR, errcode);
+			continue;
+		}
+
+		int mask = eh->GetEventMask();
+		if (revents & POLLIN)
+			mask &= ~FD_READ_WILL_BLOCK;
+		if (revents & POLLOUT)
+			mask &= ~(FD_WRITE_WILL_BLOCK | FD_WANT_SINGLE_WRITE);
+		eh->SetEventMask(mask);
+
+		if (revents & POLLIN)
+		{
+			stats.ReadEvents++;
+			eh->HandleEvent(EVENT_READ);
+			if (eh != GetRef(fd))
+				// whoa! we got deleted, better not give out the write event
+				continue;
+		}
+
+		if (revents & POLLOUT)
+		{
+			stats.WriteEvents++;
+			eh->HandleEvent(EVENT_WRITE);
+		}
+	}
+
+	return events;
+}
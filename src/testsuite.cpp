@@ -63,6 +63,9 @@ TestSuite::TestSuite()
 		std::cout << "(6) Comma sepstream tests\n";
 		std::cout << "(7) Space sepstream tests\n";
 		std::cout << "(8) UID generation tests\n";
+		std::cout << "(9) Channel member map benchmark\n";
+		std::cout << "(A) Tokenizer tests\n";
+		std::cout << "(T) Timer tests\n";
 
 		std::cout << std::endl << "(X) Exit test suite\n";
 
@@ -110,6 +113,15 @@ TestSuite::TestSuite()
 			case '8':
 				std::cout << (DoGenerateUIDTests() ? "\nSUCCESS!\n" : "\nFAILURE\n");
 				break;
+			case '9':
+				std::cout << (DoMemberMapBenchmark() ? "\nSUCCESS!\n" : "\nFAILURE\n");
+				break;
+			case 'A':
+				std::cout << (DoTokenizeTests() ? "\nSUCCESS!\n" : "\nFAILURE\n");
+				break;
+			case 'T':
+				std::cout << (DoTimerTests() ? "\nSUCCESS!\n" : "\nFAILURE\n");
+				break;
 			case 'X':
 				return;
 				break;
@@ -121,16 +133,44 @@ TestSuite::TestSuite()
 	}
 }
 
-/* Test that x matches y with match() */
-#define WCTEST(x, y) std::cout << "match(\"" << x << "\",\"" << y "\") " << ((passed = (InspIRCd::Match(x, y, NULL))) ? " SUCCESS!\n" : " FAILURE\n")
-/* Test that x does not match y with match() */
-#define WCTESTNOT(x, y) std::cout << "!match(\"" << x << "\",\"" << y "\") " << ((passed = ((!InspIRCd::Match(x, y, NULL)))) ? " SUCCESS!\n" : " FAILURE\n")
+/* Check that match() and a WildcardMask built from y agree on whether x matches y */
+static bool WildcardCheck(const std::string& x, const std::string& y, const unsigned char* map, bool expected)
+{
+	return ((InspIRCd::Match(x, y, map) == expected) && (WildcardMask(y, map).Match(x) == expected));
+}
+
+/* Test that x matches y with match() and WildcardMask */
+#define WCTEST(x, y) std::cout << "match(\"" << x << "\",\"" << y "\") " << ((passed = (WildcardCheck(x, y, NULL, true))) ? " SUCCESS!\n" : " FAILURE\n")
+/* Test that x does not match y with match() and WildcardMask */
+#define WCTESTNOT(x, y) std::cout << "!match(\"" << x << "\",\"" << y "\") " << ((passed = (WildcardCheck(x, y, NULL, false))) ? " SUCCESS!\n" : " FAILURE\n")
+
+/* Test that x matches y with match() and WildcardMask using the case map m */
+#define WCTESTMAP(x, y, m) std::cout << "match(\"" << x << "\",\"" << y "\", " #m ") " << ((passed = (WildcardCheck(x, y, m, true))) ? " SUCCESS!\n" : " FAILURE\n")
+/* Test that x does not match y with match() and WildcardMask using the case map m */
+#define WCTESTMAPNOT(x, y, m) std::cout << "!match(\"" << x << "\",\"" << y "\", " #m ") " << ((passed = (WildcardCheck(x, y, m, false))) ? " SUCCESS!\n" : " FAILURE\n")
 
 /* Test that x matches y with match() and cidr enabled */
 #define CIDRTEST(x, y) std::cout << "match(\"" << x << "\",\"" << y "\", true) " << ((passed = (InspIRCd::MatchCIDR(x, y, NULL))) ? " SUCCESS!\n" : " FAILURE\n")
 /* Test that x does not match y with match() and cidr enabled */
 #define CIDRTESTNOT(x, y) std::cout << "!match(\"" << x << "\",\"" << y "\", true) " << ((passed = ((!InspIRCd::MatchCIDR(x, y, NULL)))) ? " SUCCESS!\n" : " FAILURE\n")
 
+/* Check that the mask y parses and whether the address x is inside it */
+static bool ParsedCIDRCheck(const std::string& x, const std::string& y, bool expected)
+{
+	irc::sockets::cidr_mask cidr;
+	irc::sockets::sockaddrs sa;
+	if ((!irc::sockets::ParseCIDR(y, cidr)) || (!irc::sockets::aptosa(x, 0, sa)))
+		return false;
+	return (cidr.match(sa) == expected);
+}
+
+/* Test that x is inside the mask y with ParseCIDR() and cidr_mask::match() */
+#define PARSECIDRTEST(x, y) std::cout << "cidr_mask(\"" << y << "\").match(\"" << x << "\") " << ((passed = (ParsedCIDRCheck(x, y, true))) ? " SUCCESS!\n" : " FAILURE\n")
+/* Test that x is not inside the mask y with ParseCIDR() and cidr_mask::match() */
+#define PARSECIDRTESTNOT(x, y) std::cout << "!cidr_mask(\"" << y << "\").match(\"" << x << "\") " << ((passed = (ParsedCIDRCheck(x, y, false))) ? " SUCCESS!\n" : " FAILURE\n")
+/* Test that y is rejected by ParseCIDR() and does not match x as a CIDR mask */
+#define BADCIDRTEST(x, y) std::cout << "!ParseCIDR(\"" << y << "\") " << ((passed = (!ParsedCIDRCheck(x, y, true) && !ParsedCIDRCheck(x, y, false) && !irc::sockets::MatchCIDR(x, y, true))) ? " SUCCESS!\n" : " FAILURE\n")
+
 bool TestSuite::DoWildTests()
 {
 	std::cout << "\n\nWildcard and CIDR tests\n\n";
@@ -188,6 +228,30 @@ bool TestSuite::DoWildTests()
 	WCTESTNOT("foobar.tst", "fo?bar.*g");
 	WCTESTNOT("foobar.test", "fo?bar.*tt");
 
+	WCTEST("foobar", "???bar");
+	WCTEST("foobar", "foo???");
+	WCTEST("foobar", "*???*");
+	WCTEST("foobar", "foo*???");
+	WCTEST("foobar", "???*???");
+	WCTEST("foo", "?*?*?");
+	WCTEST("abc", "???");
+	WCTESTNOT("fo", "???");
+	WCTESTNOT("abcd", "???");
+	WCTESTNOT("ab", "?*?*?");
+	WCTESTNOT("foob", "foo*??");
+	WCTESTNOT("fo", "*???*");
+
+	WCTEST("FooBar", "foo*");
+	WCTEST("foo[bar]", "FOO{BAR}");
+	WCTESTMAP("foo[bar]", "FOO{BAR}", rfc_case_insensitive_map);
+	WCTESTMAP("foo[bar]", "FOO{BAR}", national_case_insensitive_map);
+	WCTESTMAPNOT("foo[bar]", "FOO{BAR}", ascii_case_insensitive_map);
+	WCTESTMAP("foo[bar]", "FOO[BAR]", ascii_case_insensitive_map);
+	WCTESTMAP("foo\\bar", "*|B?R", rfc_case_insensitive_map);
+	WCTESTMAPNOT("foo\\bar", "*|B?R", ascii_case_insensitive_map);
+	WCTESTMAPNOT("FOO^", "*?~", rfc_case_insensitive_map);
+	WCTESTMAP("FOO^", "f*?^", ascii_case_insensitive_map);
+
 	CIDRTEST("brain@1.2.3.4", "*@1.2.0.0/16");
 	CIDRTEST("brain@1.2.3.4", "*@1.2.3.0/24");
 	CIDRTEST("192.168.3.97", "192.168.3.0/24");
@@ -200,6 +264,69 @@ bool TestSuite::DoWildTests()
 	CIDRTESTNOT("brain@1.2.3.4", "@");
 	CIDRTESTNOT("brain@1.2.3.4", "");
 
+	CIDRTEST("1.2.3.4", "0.0.0.0/0");
+	CIDRTEST("brain@255.255.255.255", "*@0.0.0.0/0");
+	CIDRTEST("1.2.3.4", "1.2.3.4/32");
+	CIDRTESTNOT("1.2.3.5", "1.2.3.4/32");
+	CIDRTEST("10.0.0.129", "10.0.0.128/25");
+	CIDRTESTNOT("10.0.0.127", "10.0.0.128/25");
+	CIDRTEST("172.31.255.255", "172.16.0.0/12");
+	CIDRTESTNOT("172.32.0.1", "172.16.0.0/12");
+	CIDRTEST("1.2.3.4", "1.2.2.0/23");
+	CIDRTESTNOT("1.2.4.4", "1.2.2.0/23");
+	CIDRTEST("brain@1.2.3.4", "*@1.2.3.5/31");
+	CIDRTESTNOT("brain@1.2.3.4", "*@1.2.3.6/31");
+
+	CIDRTEST("2001:db8::1", "2001:db8::/32");
+	CIDRTEST("brain@2001:db8:ffff::1", "*@2001:db8::/32");
+	CIDRTESTNOT("2001:db9::1", "2001:db8::/32");
+	CIDRTEST("2001:db8:7fff::1", "2001:db8::/33");
+	CIDRTESTNOT("2001:db8:8000::1", "2001:db8::/33");
+	CIDRTEST("::1", "::/0");
+	CIDRTEST("::1", "::1/128");
+	CIDRTESTNOT("::2", "::1/128");
+	CIDRTESTNOT("1.2.3.4", "::/0");
+	CIDRTESTNOT("::1", "0.0.0.0/0");
+
+	CIDRTEST("1.2.3.4", "1.2.3.4/33");
+	CIDRTESTNOT("1.2.3.5", "1.2.3.4/33");
+	CIDRTEST("1.2.3.4", "1.2.3.4/999");
+	CIDRTEST("2001:db8::1", "2001:db8::1/200");
+	CIDRTESTNOT("2001:db8::2", "2001:db8::1/200");
+
+	PARSECIDRTEST("1.2.3.4", "0.0.0.0/0");
+	PARSECIDRTEST("1.2.3.4", "1.2.3.4/32");
+	PARSECIDRTESTNOT("1.2.3.5", "1.2.3.4/32");
+	PARSECIDRTEST("1.2.3.4", "1.2.2.0/23");
+	PARSECIDRTESTNOT("1.2.4.4", "1.2.2.0/23");
+	PARSECIDRTEST("2001:db8::1", "2001:db8::1/128");
+	PARSECIDRTESTNOT("2001:db8::1:1", "2001:db8::/113");
+	PARSECIDRTEST("2001:db8::7fff", "2001:db8::/113");
+	PARSECIDRTESTNOT("::1", "1.2.3.4/0");
+	PARSECIDRTEST("1.2.3.4", "1.2.3.4/33");
+	PARSECIDRTESTNOT("1.2.3.5", "1.2.3.4/33");
+
+	/* Masks which can not be parsed never match as CIDR masks, even against an identical string */
+	BADCIDRTEST("foo", "foo");
+	BADCIDRTEST("abc/8", "abc/8");
+	BADCIDRTEST("1.2.3.4", "1.2.3.4");
+	BADCIDRTEST("1.2.3.4", "1.2.3.4/");
+	BADCIDRTEST("1.2.3.4", "1.2.3.4/x");
+	BADCIDRTEST("1.2.3.4", "1.2.3.4/8x");
+	BADCIDRTEST("1.2.3.4", "1.2.3/24");
+	BADCIDRTEST("1.2.3.4", "/24");
+	BADCIDRTEST("1.2.3.4", "*.2.3.4/24");
+	CIDRTESTNOT("brain@host.example", "*@1.2.3.0/24");
+	CIDRTESTNOT("brain@1.2.3", "*@1.2.3.0/24");
+
+	std::cout << "cidr_mask().match(\"0.0.0.0\") ";
+	{
+		irc::sockets::sockaddrs sa;
+		irc::sockets::aptosa("0.0.0.0", 0, sa);
+		passed = !irc::sockets::cidr_mask().match(sa);
+		std::cout << (passed ? " SUCCESS!\n" : " FAILURE\n");
+	}
+
 	return true;
 }
 
@@ -280,6 +407,57 @@ bool TestSuite::DoSpaceSepStreamTests()
 	return true;
 }
 
+/* Check that irc::tokenize() splits x into the same n tokens as irc::tokenstream */
+static bool TokenizeCheck(const std::string& x, size_t n)
+{
+	std::vector<std::string> expected;
+	irc::tokenstream stream(x);
+	std::string token;
+	while (stream.GetToken(token))
+		expected.push_back(token);
+
+	irc::tokenlist tokens;
+	irc::tokenize(x, tokens);
+
+	if ((expected.size() != n) || (tokens.size() != n))
+		return false;
+
+	for (size_t i = 0; i < n; ++i)
+	{
+		if (tokens[i].str() != expected[i])
+			return false;
+	}
+	return true;
+}
+
+/* Test that tokenize() and tokenstream both split x into n tokens which are the same */
+#define TOKENIZETEST(x, n) std::cout << "tokenize(\"" << x << "\") == tokenstream(\"" << x << "\") " << ((passed = (TokenizeCheck(x, n))) ? "SUCCESS\n" : "FAILURE\n")
+
+bool TestSuite::DoTokenizeTests()
+{
+	bool passed = false;
+
+	TOKENIZETEST("", 0);
+	TOKENIZETEST("   ", 0);
+	TOKENIZETEST("PING", 1);
+	TOKENIZETEST("PRIVMSG #chan :hello world", 3);
+	TOKENIZETEST(":nick!user@host PRIVMSG #chan :hello world", 4);
+	TOKENIZETEST(":server.name 001", 2);
+	TOKENIZETEST("  :prefix CMD", 2);
+	TOKENIZETEST("MODE   #chan    +o     nick", 4);
+	TOKENIZETEST("   MODE #chan +o nick   ", 4);
+	TOKENIZETEST("PRIVMSG #chan :", 3);
+	TOKENIZETEST("PRIVMSG #chan :a b  ", 3);
+	TOKENIZETEST("PRIVMSG #chan   :  a  b", 3);
+	TOKENIZETEST("PRIVMSG #chan :a :b :c", 3);
+	TOKENIZETEST("PRIVMSG #chan a:b", 3);
+	TOKENIZETEST("CMD 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15", 16);
+	TOKENIZETEST("CMD 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16", 17);
+	TOKENIZETEST(":prefix CMD 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 :last  param ", 23);
+
+	return true;
+}
+
 bool TestSuite::DoThreadTests()
 {
 	std::string anything;
@@ -394,6 +572,249 @@ bool TestSuite::DoGenerateUIDTests()
 	return true;
 }
 
+namespace
+{
+	/** The member list Channel used before, with the Membership constructed in the std::map node
+	 */
+	class StdMapChannel
+	{
+		typedef std::map<User*, insp::aligned_storage<Membership> > MemberMap;
+		MemberMap userlist;
+
+	 public:
+		Membership* AddUser(User* user)
+		{
+			std::pair<MemberMap::iterator, bool> ret = userlist.insert(std::make_pair(user, insp::aligned_storage<Membership>()));
+			if (!ret.second)
+				return NULL;
+
+			Membership* memb = ret.first->second;
+			return new(memb) Membership(user, NULL);
+		}
+
+		bool HasUser(User* user)
+		{
+			return (userlist.find(user) != userlist.end());
+		}
+
+		void DelUser(User* user)
+		{
+			MemberMap::iterator it = userlist.find(user);
+			if (it == userlist.end())
+				return;
+
+			Membership* memb = it->second;
+			memb->cull();
+			memb->~Membership();
+			userlist.erase(it);
+		}
+	};
+
+	unsigned long ElapsedMs(clock_t start, clock_t end)
+	{
+		return (end - start) * 1000 / CLOCKS_PER_SEC;
+	}
+
+	/** Join every user to its channels, look every membership up, then part every user from every channel
+	 * @param name Name of the member list to show in the results
+	 * @param channels The channels
+	 * @param users The users
+	 * @param chans The channels of each user, users.size() * chansperuser indexes into channels
+	 * @param chansperuser The number of channels each user joins
+	 */
+	template <typename Chan>
+	void RunMemberMapBenchmark(const char* name, const std::vector<Chan*>& channels, const std::vector<User*>& users, const std::vector<size_t>& chans, size_t chansperuser)
+	{
+		const clock_t start = clock();
+		for (size_t i = 0; i < chans.size(); i++)
+			channels[chans[i]]->AddUser(users[i / chansperuser]);
+
+		const clock_t joined = clock();
+		size_t found = 0;
+		for (size_t i = 0; i < chans.size(); i++)
+		{
+			// One lookup of a member and one of a user who is most likely not on the channel
+			found += channels[chans[i]]->HasUser(users[i / chansperuser]);
+			found += channels[chans[i]]->HasUser(users[(i / chansperuser + 1) % users.size()]);
+		}
+
+		const clock_t lookedup = clock();
+		for (size_t i = 0; i < chans.size(); i++)
+			channels[chans[i]]->DelUser(users[i / chansperuser]);
+
+		const clock_t parted = clock();
+
+		std::cout << name << ": join " << ElapsedMs(start, joined) << " ms, lookup " << ElapsedMs(joined, lookedup)
+			<< " ms, part " << ElapsedMs(lookedup, parted) << " ms (" << found << " found)\n";
+	}
+}
+
+bool TestSuite::DoMemberMapBenchmark()
+{
+	const size_t usercount = 100000;
+	const size_t chancount = 10000;
+	const size_t chansperuser = 10;
+
+	std::cout << "\n\nJoining and parting " << usercount << " users across " << chancount << " channels, "
+		<< chansperuser << " channels per user\n\n";
+
+	std::vector<User*> users;
+	for (size_t i = 0; i < usercount; i++)
+		users.push_back(new FakeUser(ServerInstance->UIDGen.GetUID(), ServerInstance->FakeClient->server));
+
+	// Pick distinct channels for every user with a fixed pseudo random sequence so both runs do the same work
+	std::vector<size_t> chans;
+	unsigned long seed = 1;
+	for (size_t i = 0; i < usercount; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		const size_t first = (seed >> 8) % chancount;
+		for (size_t j = 0; j < chansperuser; j++)
+			chans.push_back((first + j * 1009) % chancount);
+	}
+
+	std::vector<StdMapChannel*> oldchannels;
+	for (size_t i = 0; i < chancount; i++)
+		oldchannels.push_back(new StdMapChannel);
+
+	RunMemberMapBenchmark("std::map", oldchannels, users, chans, chansperuser);
+	stdalgo::delete_all(oldchannels);
+
+	std::vector<Channel*> channels;
+	for (size_t i = 0; i < chancount; i++)
+		channels.push_back(new Channel("#membermapbenchmark" + ConvToStr(i), ServerInstance->Time()));
+
+	// Channel::DelUser() queues every channel for culling when its last member parts
+	RunMemberMapBenchmark("Channel", channels, users, chans, chansperuser);
+
+	for (std::vector<User*>::const_iterator i = users.begin(); i != users.end(); ++i)
+	{
+		ServerInstance->Users->uuidlist.erase((*i)->uuid);
+		ServerInstance->GlobalCulls.AddItem(*i);
+	}
+	ServerInstance->GlobalCulls.Apply();
+	return true;
+}
+
+class TestSuiteTimer : public Timer
+{
+ public:
+	/** The time the timer ticked at, 0 if it has not ticked */
+	uint64_t ticked;
+
+	TestSuiteTimer() : Timer(0), ticked(0)
+	{
+	}
+
+	bool Tick(time_t)
+	{
+		ticked = TimerManager::GetTime();
+		return true;
+	}
+};
+
+/** A timer which repeats with an interval of 0, so it is due again as soon as it has ticked */
+class TestSuiteRepeatTimer : public Timer
+{
+ public:
+	/** Number of times the timer ticked */
+	unsigned int ticks;
+
+	TestSuiteRepeatTimer() : Timer(0, true), ticks(0)
+	{
+	}
+
+	bool Tick(time_t)
+	{
+		ticks++;
+		return true;
+	}
+};
+
+/** A timer which puts itself back with an interval of 0 from Tick(), as XLineApplyTimer does while lines are left to apply */
+class TestSuiteRearmTimer : public Timer
+{
+ public:
+	/** Number of times the timer ticked */
+	unsigned int ticks;
+
+	TestSuiteRearmTimer() : Timer(0), ticks(0)
+	{
+	}
+
+	bool Tick(time_t)
+	{
+		ticks++;
+		SetInterval(0);
+		return true;
+	}
+};
+
+bool TestSuite::DoTimerTests()
+{
+	TimerManager& timers = ServerInstance->Timers;
+
+	// Wait until the root wheel (256 slots) is past the middle of its rotation, so that a timer
+	// 200ms away goes into a slot before the current one and only runs after the wheel wraps
+	uint64_t now;
+	for (;;)
+	{
+		timers.TickTimers(ServerInstance->Time());
+		now = TimerManager::GetTime();
+		if ((now & 255) >= 100 && (now & 255) < 200)
+			break;
+		usleep(1000);
+	}
+
+	TestSuiteTimer timer;
+	timer.SetIntervalMs(200);
+	const uint64_t due = now + 200;
+	std::cout << "Timer added at wheel position " << (now & 255) << ", due at position " << (due & 255) << "\n";
+
+	const long timeout = timers.GetNextTimeout(1000);
+	bool passed = (timeout <= 200);
+	std::cout << "GetNextTimeout(1000) = " << timeout << (passed ? " SUCCESS!\n" : " FAILURE\n");
+
+	while (!timer.ticked && TimerManager::GetTime() < due + 1000)
+	{
+		usleep(std::max(timers.GetNextTimeout(1000), 1L) * 1000);
+		timers.TickTimers(ServerInstance->Time());
+	}
+
+	const bool ontime = (timer.ticked >= due && timer.ticked < due + 20);
+	std::cout << "Timer ticked " << (timer.ticked ? static_cast<long>(timer.ticked - due) : -1) << "ms after it was due" << (ontime ? " SUCCESS!\n" : " FAILURE\n");
+
+	// A timer which is due again when it is put back must wait for the next TickTimers() call,
+	// even if the wheel is a few slots behind the clock and TickTimers() runs them all
+	bool repeatonce = true;
+	{
+		TestSuiteRepeatTimer repeattimer;
+		repeattimer.SetIntervalMs(0);
+		for (unsigned int pass = 1; pass <= 5; pass++)
+		{
+			usleep(3000);
+			timers.TickTimers(ServerInstance->Time());
+			repeatonce = repeatonce && (repeattimer.ticks == pass) && (timers.GetNextTimeout(1000) <= 1);
+		}
+		std::cout << "Repeating timer with interval 0 ticked " << repeattimer.ticks << " times in 5 passes" << (repeatonce ? " SUCCESS!\n" : " FAILURE\n");
+	}
+
+	bool rearmonce = true;
+	{
+		TestSuiteRearmTimer rearmtimer;
+		rearmtimer.SetInterval(0);
+		for (unsigned int pass = 1; pass <= 5; pass++)
+		{
+			usleep(3000);
+			timers.TickTimers(ServerInstance->Time());
+			rearmonce = rearmonce && (rearmtimer.ticks == pass) && (timers.GetNextTimeout(1000) <= 1);
+		}
+		std::cout << "Timer re-armed with interval 0 by Tick() ticked " << rearmtimer.ticks << " times in 5 passes" << (rearmonce ? " SUCCESS!\n" : " FAILURE\n");
+	}
+
+	return passed && ontime && repeatonce && rearmonce;
+}
+
 TestSuite::~TestSuite()
 {
 	std::cout << "\n\n*** END OF TEST SUITE ***\n";
@@ -23,17 +23,23 @@
 #include "inspircd.h"
 
 void Timer::SetInterval(time_t newinterval)
+{
+	SetIntervalMs(newinterval * 1000);
+}
+
+void Timer::SetIntervalMs(unsigned long msecs)
 {
 	ServerInstance->Timers.DelTimer(this);
-	secs = newinterval;
-	SetTrigger(ServerInstance->Time() + newinterval);
+	interval = msecs;
+	expiry = TimerManager::GetTime() + msecs;
 	ServerInstance->Timers.AddTimer(this);
 }
 
 Timer::Timer(unsigned int secs_from_now, bool repeating)
-	: trigger(ServerInstance->Time() + secs_from_now)
-	, secs(secs_from_now)
+	: expiry(TimerManager::GetTime() + secs_from_now * 1000ULL)
+	, interval(secs_from_now * 1000UL)
 	, repeat(repeating)
+	, slot(NULL)
 {
 }
 
@@ -42,42 +48,225 @@ Timer::~Timer()
 	ServerInstance->Timers.DelTimer(this);
 }
 
+time_t Timer::GetTrigger() const
+{
+	const uint64_t now = TimerManager::GetTime();
+	if (expiry <= now)
+		return ServerInstance->Time();
+	return ServerInstance->Time() + (expiry - now + 999) / 1000;
+}
+
+void Timer::SetTrigger(time_t nexttrigger)
+{
+	const time_t now = ServerInstance->Time();
+	expiry = TimerManager::GetTime() + (nexttrigger > now ? (nexttrigger - now) * 1000ULL : 0);
+}
+
+TimerManager::TimerManager()
+	: current(GetTime())
+	, nextpass(0)
+	, count(0)
+	, expired(0)
+	, lastexpired(0)
+	, expiredtime(0)
+{
+}
+
+uint64_t TimerManager::GetTime()
+{
+#ifdef _WIN32
+	return GetTickCount64();
+#elif defined HAS_CLOCK_GETTIME
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000;
+#else
+	timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000ULL + tv.tv_usec / 1000;
+#endif
+}
+
+void TimerManager::Schedule(Timer* t)
+{
+	// Timers which are already due go into the next slot to run. While TickTimers() runs timers that is
+	// the first slot after the ones it runs in this call, so a timer added again by Tick() waits for the next call
+	uint64_t when = std::max(t->expiry, std::max(current, nextpass));
+	const uint64_t delta = when - current;
+
+	TimerList* list;
+	if (delta < ROOT_SIZE)
+	{
+		list = &root[when & (ROOT_SIZE - 1)];
+	}
+	else
+	{
+		unsigned int level = 0;
+		unsigned int shift = ROOT_BITS + LEVEL_BITS;
+		while (level < LEVELS - 1 && delta >= (uint64_t(1) << shift))
+		{
+			level++;
+			shift += LEVEL_BITS;
+		}
+
+		// Timers further away than the last wheel can hold are put into its furthest
+		// slot, they are scheduled again with their real expiry when that slot is reached
+		if (delta >= (uint64_t(1) << shift))
+			when = current + (uint64_t(1) << shift) - 1;
+
+		list = &levels[level][(when >> (shift - LEVEL_BITS)) & (LEVEL_SIZE - 1)];
+	}
+
+	list->push_front(t);
+	t->slot = list;
+}
+
+unsigned int TimerManager::Cascade(unsigned int level)
+{
+	const unsigned int index = (current >> (ROOT_BITS + level * LEVEL_BITS)) & (LEVEL_SIZE - 1);
+	TimerList& list = levels[level][index];
+	while (!list.empty())
+	{
+		Timer* t = list.front();
+		list.pop_front();
+		Schedule(t);
+	}
+	return index;
+}
+
 void TimerManager::TickTimers(time_t TIME)
 {
-	for (TimerMap::iterator i = Timers.begin(); i != Timers.end(); )
+	if (TIME != expiredtime)
 	{
-		Timer* t = i->second;
-		if (t->GetTrigger() > TIME)
-			break;
+		lastexpired = (TIME == expiredtime + 1) ? expired : 0;
+		expired = 0;
+		expiredtime = TIME;
+	}
+
+	const uint64_t now = GetTime();
+	if (!count)
+	{
+		// Nothing to run, so there is no need to turn the wheels one slot at a time
+		if (current <= now)
+			current = now + 1;
+		return;
+	}
 
-		Timers.erase(i++);
+	while (current <= now)
+	{
+		const unsigned int index = current & (ROOT_SIZE - 1);
 
-		if (!t->Tick(TIME))
-			continue;
+		// The root wheel has wrapped around, bring down the timers for the next rotation
+		if (!index)
+		{
+			for (unsigned int level = 0; level < LEVELS; level++)
+			{
+				if (Cascade(level))
+					break;
+			}
+		}
 
-		if (t->GetRepeat())
+		TimerList& list = root[index];
+		nextpass = now + 1;
+		while (!list.empty())
 		{
-			t->SetTrigger(TIME + t->GetInterval());
-			AddTimer(t);
+			Timer* t = list.front();
+			list.pop_front();
+			t->slot = NULL;
+			count--;
+
+			// Clamped to the last wheel, or moved with SetTrigger()
+			if (t->expiry > current)
+			{
+				AddTimer(t);
+				continue;
+			}
+
+			expired++;
+			if (!t->Tick(TIME))
+				continue;
+
+			if (t->repeat && !t->slot)
+			{
+				t->expiry = now + t->interval;
+				AddTimer(t);
+			}
 		}
+		nextpass = 0;
+
+		current++;
 	}
 }
 
-void TimerManager::DelTimer(Timer* t)
+long TimerManager::GetNextTimeout(long max) const
 {
-	std::pair<TimerMap::iterator, TimerMap::iterator> itpair = Timers.equal_range(t->GetTrigger());
+	if (!count)
+		return max;
 
-	for (TimerMap::iterator i = itpair.first; i != itpair.second; ++i)
+	const uint64_t now = GetTime();
+	uint64_t next = now + max;
+
+	// The root wheel holds the timers of the next ROOT_SIZE milliseconds, including the
+	// ones in the slots before the current one which are due after the wheel wraps around
+	const uint64_t rootend = std::min(next, current + ROOT_SIZE);
+	for (uint64_t when = current; when < rootend; when++)
 	{
-		if (i->second == t)
+		if (!root[when & (ROOT_SIZE - 1)].empty())
 		{
-			Timers.erase(i);
+			next = when;
 			break;
 		}
 	}
+
+	// Timers in the other wheels can't expire before their slot is cascaded
+	unsigned int shift = ROOT_BITS;
+	for (unsigned int level = 0; level < LEVELS; level++)
+	{
+		// If the wheels are at the start of a rotation, its slot has not been cascaded yet
+		const uint64_t base = current >> shift;
+		const uint64_t first = (current & ((uint64_t(1) << shift) - 1)) ? base + 1 : base;
+		for (uint64_t slot = first; slot < first + LEVEL_SIZE; slot++)
+		{
+			const uint64_t start = slot << shift;
+			if (start >= next)
+				break;
+
+			if (!levels[level][slot & (LEVEL_SIZE - 1)].empty())
+			{
+				next = start;
+				break;
+			}
+		}
+		shift += LEVEL_BITS;
+	}
+
+	return (next > now ? static_cast<long>(next - now) : 0);
+}
+
+unsigned long TimerManager::GetExpiredPerSecond() const
+{
+	// Nothing has ticked since the last full second if the count was not rolled over then
+	return (ServerInstance->Time() <= expiredtime + 1) ? lastexpired : 0;
+}
+
+void TimerManager::DelTimer(Timer* t)
+{
+	if (!t->slot)
+		return;
+
+	t->slot->erase(t);
+	t->slot = NULL;
+	count--;
 }
 
 void TimerManager::AddTimer(Timer* t)
 {
-	Timers.insert(std::make_pair(t->GetTrigger(), t));
+	DelTimer(t);
+
+	// The wheels stop turning while they are empty, catch up before using them again
+	if ((!count) && (!nextpass))
+		current = std::max(current, GetTime());
+
+	Schedule(t);
+	count++;
 }
@@ -75,6 +75,7 @@ void UserManager::AddUser(int socket, ListenSocket* via, irc::sockets::sockaddrs
 	this->AddClone(New);
 
 	this->local_users.push_front(New);
+	ServerInstance->XLines->IndexLocalUser(New);
 
 	if (this->local_users.size() > ServerInstance->Config->SoftLimit)
 	{
@@ -97,6 +98,9 @@ void UserManager::AddUser(int socket, ListenSocket* via, irc::sockets::sockaddrs
 	if (New->quitting)
 		return;
 
+	// The user is checked again when this runs out or when something calls CheckReady() for them
+	New->timeouttimer.SetInterval(New->MyClass->GetRegTimeout() + 1);
+
 	/*
 	 * even with bancache, we still have to keep User::exempt current.
 	 * besides that, if we get a positive bancache hit, we still won't fuck
@@ -104,7 +108,7 @@ void UserManager::AddUser(int socket, ListenSocket* via, irc::sockets::sockaddrs
 	 */
 	New->exempt = (ServerInstance->XLines->MatchesLine("E",New) != NULL);
 
-	BanCacheHit* const b = ServerInstance->BanCache.GetHit(New->GetIPString());
+	BanCacheHit* const b = ServerInstance->BanCache.GetHit(New->client_sa);
 	if (b)
 	{
 		if (!b->Type.empty() && !New->exempt)
@@ -190,10 +194,13 @@ void UserManager::QuitUser(User* user, const std::string& quitreason, const std:
 		LocalUser* lu = IS_LOCAL(user);
 		FOREACH_MOD(OnUserDisconnect, (lu));
 		lu->eh.Close();
+		ServerInstance->Timers.DelTimer(&lu->timeouttimer);
+		ServerInstance->Timers.DelTimer(&lu->fakelagtimer);
 
 		if (lu->registered == REG_ALL)
 			ServerInstance->SNO->WriteToSnoMask('q',"Client exiting: %s (%s) [%s]", user->GetFullRealHost().c_str(), user->GetIPString().c_str(), operreason->c_str());
 		local_users.erase(lu);
+		ServerInstance->XLines->UnindexLocalUser(lu);
 	}
 
 	if (!clientlist.erase(user->nick))
@@ -273,68 +280,3 @@ bool UserManager::AllModulesReportReady(LocalUser* user)
 	FIRST_MOD_RESULT(OnCheckReady, res, (user));
 	return (res == MOD_RES_PASSTHRU);
 }
-
-/**
- * This function is called once a second from the mainloop.
- * It is intended to do background checking on all the user structs, e.g.
- * stuff like ping checks, registration timeouts, etc.
- */
-void UserManager::DoBackgroundUserStuff()
-{
-	/*
-	 * loop over all local users..
-	 */
-	for (LocalList::iterator i = local_users.begin(); i != local_users.end(); ++i)
-	{
-		LocalUser* curr = *i;
-
-		if (curr->CommandFloodPenalty || curr->eh.getSendQSize())
-		{
-			unsigned int rate = curr->MyClass->GetCommandRate();
-			if (curr->CommandFloodPenalty > rate)
-				curr->CommandFloodPenalty -= rate;
-			else
-				curr->CommandFloodPenalty = 0;
-			curr->eh.OnDataReady();
-		}
-
-		switch (curr->registered)
-		{
-			case REG_ALL:
-				if (ServerInstance->Time() >= curr->nping)
-				{
-					// This user didn't answer the last ping, remove them
-					if (!curr->lastping)
-					{
-						time_t time = ServerInstance->Time() - (curr->nping - curr->MyClass->GetPingTime());
-						const std::string message = "Ping timeout: " + ConvToStr(time) + (time != 1 ? " seconds" : " second");
-						this->QuitUser(curr, message);
-						continue;
-					}
-
-					curr->Write("PING :" + ServerInstance->Config->ServerName);
-					curr->lastping = 0;
-					curr->nping = ServerInstance->Time() + curr->MyClass->GetPingTime();
-				}
-				break;
-			case REG_NICKUSER:
-				if (AllModulesReportReady(curr))
-				{
-					/* User has sent NICK/USER, modules are okay, DNS finished. */
-					curr->FullConnect();
-					continue;
-				}
-				break;
-		}
-
-		if (curr->registered != REG_ALL && (ServerInstance->Time() > (curr->age + curr->MyClass->GetRegTimeout())))
-		{
-			/*
-			 * registration timeout -- didnt send USER/NICK/HOST
-			 * in the time specified in their connection class.
-			 */
-			this->QuitUser(curr, "Registration timeout");
-			continue;
-		}
-	}
-}
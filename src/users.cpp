@@ -66,7 +66,7 @@ const char* User::FormatModes(bool showparameters)
 }
 
 User::User(const std::string& uid, Server* srv, int type)
-	: uuid(uid), server(srv), usertype(type)
+	: uuid(uid), identitygeneration(0), server(srv), usertype(type)
 {
 	age = ServerInstance->Time();
 	signon = 0;
@@ -81,9 +81,9 @@ User::User(const std::string& uid, Server* srv, int type)
 }
 
 LocalUser::LocalUser(int myfd, irc::sockets::sockaddrs* client, irc::sockets::sockaddrs* servaddr)
-	: User(ServerInstance->UIDGen.GetUID(), ServerInstance->FakeClient->server, USERTYPE_LOCAL), eh(this),
+	: User(ServerInstance->UIDGen.GetUID(), ServerInstance->FakeClient->server, USERTYPE_LOCAL), eh(this), timeouttimer(this), fakelagtimer(this),
 	bytes_in(0), bytes_out(0), cmds_in(0), cmds_out(0), nping(0), CommandFloodPenalty(0),
-	already_sent(0)
+	penaltytime(0), already_sent(0)
 {
 	exempt = quitting_sendq = false;
 	idle_lastmsg = 0;
@@ -252,14 +252,36 @@ void UserIOHandler::OnDataReady()
 	if (!user->HasPrivPermission("users/flood/no-fakelag"))
 		penaltymax = user->MyClass->GetPenaltyThreshold() * 1000;
 
+	// Take off the penalty that has decayed since we were last here
+	const unsigned int rate = user->MyClass->GetCommandRate();
+	const uint64_t now = TimerManager::GetTime();
+	const uint64_t decay = (now - user->penaltytime) * rate / 1000;
+	if (decay >= user->CommandFloodPenalty)
+	{
+		user->CommandFloodPenalty = 0;
+		user->penaltytime = now;
+	}
+	else if (decay)
+	{
+		user->CommandFloodPenalty -= decay;
+		// Keep the part of a millicommand that has not decayed yet
+		user->penaltytime += decay * 1000 / rate;
+	}
+
 	while (user->CommandFloodPenalty < penaltymax && getSendQSize() < sendqmax)
 	{
+		// Look at the line in place, nothing is copied out of the recvq except the line itself
+		const char* const data = recvq.data();
+		const size_t eol = recvq.find('\n');
+		if (eol == RecvQueue::npos)
+			// the recvq ran out before we found a newline
+			return;
+
 		std::string line;
-		line.reserve(ServerInstance->Config->Limits.MaxLine);
-		std::string::size_type qpos = 0;
-		while (qpos < recvq.length())
+		line.reserve(std::min<size_t>(eol, ServerInstance->Config->Limits.MaxLine));
+		for (size_t qpos = 0; qpos < eol; qpos++)
 		{
-			char c = recvq[qpos++];
+			char c = data[qpos];
 			switch (c)
 			{
 			case '\0':
@@ -267,21 +289,17 @@ void UserIOHandler::OnDataReady()
 				break;
 			case '\r':
 				continue;
-			case '\n':
-				goto eol_found;
 			}
 			if (line.length() < ServerInstance->Config->Limits.MaxLine - 2)
 				line.push_back(c);
 		}
-		// if we got here, the recvq ran out before we found a newline
-		return;
-eol_found:
-		// just found a newline. Terminate the string, and pull it out of recvq
-		recvq = recvq.substr(qpos);
+
+		// just found a newline, pull the line out of the recvq
+		recvq.Consume(eol + 1);
 
 		// TODO should this be moved to when it was inserted in recvq?
-		ServerInstance->stats.Recv += qpos;
-		user->bytes_in += qpos;
+		ServerInstance->stats.Recv += eol + 1;
+		user->bytes_in += eol + 1;
 		user->cmds_in++;
 
 		ServerInstance->Parser.ProcessBuffer(line, user);
@@ -289,7 +307,32 @@ eol_found:
 			return;
 	}
 	if (user->CommandFloodPenalty >= penaltymax && !user->MyClass->fakelag)
+	{
 		ServerInstance->Users->QuitUser(user, "Excess Flood");
+		return;
+	}
+
+	// Nothing is waiting, the penalty will decay by itself
+	if (recvq.find('\n') == RecvQueue::npos)
+		return;
+
+	if (user->CommandFloodPenalty >= penaltymax)
+	{
+		// Wake up as soon as the penalty has decayed below the threshold
+		const uint64_t excess = user->CommandFloodPenalty - penaltymax + 1;
+		user->fakelagtimer.SetIntervalMs((excess * 1000 + rate - 1) / rate);
+	}
+	else
+	{
+		// The sendq is over the soft limit, check again once some of it had a chance to be written
+		user->fakelagtimer.SetInterval(1);
+	}
+}
+
+bool FakeLagTimer::Tick(time_t TIME)
+{
+	user->eh.OnDataReady();
+	return true;
 }
 
 void UserIOHandler::AddWriteBuf(const std::string &data)
@@ -310,6 +353,21 @@ void UserIOHandler::AddWriteBuf(const std::string &data)
 	WriteData(data);
 }
 
+void UserIOHandler::AddWriteBuf(const reference<SendBuffer>& buffer)
+{
+	if (user->quitting_sendq)
+		return;
+	if (!user->quitting && getSendQSize() + buffer->GetData().length() > user->MyClass->GetSendqHardMax() &&
+		!user->HasPrivPermission("users/flood/increased-buffers"))
+	{
+		user->quitting_sendq = true;
+		ServerInstance->GlobalCulls.AddSQItem(user);
+		return;
+	}
+
+	WriteData(buffer);
+}
+
 void UserIOHandler::OnError(BufferedSocketError)
 {
 	ServerInstance->Users->QuitUser(user, getError());
@@ -546,6 +604,9 @@ void LocalUser::FullConnect()
 	if (quitting)
 		return;
 
+	// Registration is done, so STARTTLS can no longer add an IOHook; the connection can move to an I/O thread
+	ServerInstance->IOThreads.Attach(&eh);
+
 	this->WriteNumeric(RPL_WELCOME, ":Welcome to the %s IRC Network %s", ServerInstance->Config->Network.c_str(), GetFullRealHost().c_str());
 	this->WriteNumeric(RPL_YOURHOSTIS, ":Your host is %s, running version %s", ServerInstance->Config->ServerName.c_str(), INSPIRCD_BRANCH);
 	this->WriteNumeric(RPL_SERVERCREATED, ":This server was created %s %s", __TIME__, __DATE__);
@@ -589,11 +650,78 @@ void LocalUser::FullConnect()
 	ServerInstance->SNO->WriteToSnoMask('c',"Client connecting on port %d (class %s): %s (%s) [%s]",
 		this->GetServerPort(), this->MyClass->name.c_str(), GetFullRealHost().c_str(), this->GetIPString().c_str(), this->fullname.c_str());
 	ServerInstance->Logs->Log("BANCACHE", LOG_DEBUG, "BanCache: Adding NEGATIVE hit for " + this->GetIPString());
-	ServerInstance->BanCache.AddHit(this->GetIPString(), "", "");
+	ServerInstance->BanCache.AddHit(this->client_sa, "", "");
 	// reset the flood penalty (which could have been raised due to things like auto +x)
 	CommandFloodPenalty = 0;
 }
 
+void LocalUser::CheckReady(unsigned int secs)
+{
+	if ((registered == REG_ALL) || (quitting))
+		return;
+
+	// Only ever move the check closer, the registration timeout is still due after it
+	if (timeouttimer.GetTrigger() > ServerInstance->Time() + (time_t)secs)
+		timeouttimer.SetInterval(secs);
+}
+
+bool UserTimeoutTimer::Tick(time_t TIME)
+{
+	if (user->quitting)
+		return true;
+
+	if (user->registered != REG_ALL)
+	{
+		// Sleep until the registration timeout. This is done before asking the modules
+		// so that any of them can bring the next check forward with LocalUser::CheckReady()
+		const time_t deadline = user->age + user->MyClass->GetRegTimeout();
+		SetInterval(std::max<time_t>(deadline + 1 - TIME, 1));
+
+		if (user->registered == REG_NICKUSER && ServerInstance->Users->AllModulesReportReady(user))
+		{
+			/* User has sent NICK/USER, modules are okay, DNS finished. */
+			user->FullConnect();
+			if ((user->quitting) || (user->registered != REG_ALL))
+				return true;
+		}
+		else if (TIME > deadline)
+		{
+			/*
+			 * registration timeout -- didnt send USER/NICK/HOST
+			 * in the time specified in their connection class.
+			 */
+			ServerInstance->Users->QuitUser(user, "Registration timeout");
+			return true;
+		}
+		else
+		{
+			return true;
+		}
+	}
+	else if (TIME >= user->nping)
+	{
+		// This user didn't answer the last ping, remove them
+		if (!user->lastping)
+		{
+			time_t time = TIME - (user->nping - user->MyClass->GetPingTime());
+			const std::string message = "Ping timeout: " + ConvToStr(time) + (time != 1 ? " seconds" : " second");
+			ServerInstance->Users->QuitUser(user, message);
+			return true;
+		}
+
+		user->Write("PING :" + ServerInstance->Config->ServerName);
+		user->lastping = 0;
+		user->nping = TIME + user->MyClass->GetPingTime();
+
+		// The user has been idle for a whole ping period, don't keep a receive buffer for them
+		user->eh.ReleaseRecvBuffer();
+	}
+
+	// Sleep until the next ping is due, this is also where activity since the last tick is picked up
+	SetInterval(std::max<time_t>(user->nping - TIME, 1));
+	return true;
+}
+
 void User::InvalidateCache()
 {
 	/* Invalidate cache */
@@ -601,6 +729,7 @@ void User::InvalidateCache()
 	cached_hostip.clear();
 	cached_makehost.clear();
 	cached_fullrealhost.clear();
+	identitygeneration++;
 }
 
 bool User::ChangeNick(const std::string& newnick, time_t newts)
@@ -713,6 +842,7 @@ bool User::SetClientIP(const char* sip, bool recheck_eline)
 {
 	cachedip.clear();
 	cached_hostip.clear();
+	identitygeneration++;
 	return irc::sockets::aptosa(sip, 0, client_sa);
 }
 
@@ -720,6 +850,7 @@ void User::SetClientIP(const irc::sockets::sockaddrs& sa, bool recheck_eline)
 {
 	cachedip.clear();
 	cached_hostip.clear();
+	identitygeneration++;
 	memcpy(&client_sa, &sa, sizeof(irc::sockets::sockaddrs));
 }
 
@@ -739,6 +870,7 @@ void LocalUser::SetClientIP(const irc::sockets::sockaddrs& sa, bool recheck_elin
 	if (sa != client_sa)
 	{
 		User::SetClientIP(sa);
+		ServerInstance->XLines->IndexLocalUser(this);
 		if (recheck_eline)
 			this->exempt = (ServerInstance->XLines->MatchesLine("E", this) != NULL);
 
@@ -746,7 +878,7 @@ void LocalUser::SetClientIP(const irc::sockets::sockaddrs& sa, bool recheck_elin
 	}
 }
 
-static std::string wide_newline("\r\n");
+static const char wide_newline[] = "\r\n";
 
 void User::Write(const std::string& text)
 {
@@ -756,26 +888,70 @@ void User::Write(const char *text, ...)
 {
 }
 
+LineBuilder::LineBuilder()
+	: buffer(new SendBuffer)
+{
+	buffer->data.reserve(ServerInstance->Config->Limits.MaxLine);
+}
+
+LineBuilder::LineBuilder(const std::string& source)
+	: buffer(new SendBuffer)
+{
+	std::string& data = buffer->data;
+	data.reserve(ServerInstance->Config->Limits.MaxLine);
+	data.push_back(':');
+	data.append(source).push_back(' ');
+}
+
+LineBuilder& LineBuilder::AppendNumeric(unsigned int numeric)
+{
+	if (numeric > 999)
+		return Append(ConvToStr(numeric));
+
+	std::string& data = buffer->data;
+	data.push_back('0' + numeric / 100);
+	data.push_back('0' + numeric / 10 % 10);
+	data.push_back('0' + numeric % 10);
+	return *this;
+}
+
+const reference<SendBuffer>& LineBuilder::Finish()
+{
+	std::string& data = buffer->data;
+	const std::string::size_type maxlen = ServerInstance->Config->Limits.MaxLine - 2;
+	if (data.length() > maxlen)
+		data.erase(maxlen);
+	data.append(wide_newline, 2);
+	return buffer;
+}
+
 void LocalUser::Write(const std::string& text)
 {
 	if (!SocketEngine::BoundsCheckFd(&eh))
 		return;
 
-	if (text.length() > ServerInstance->Config->Limits.MaxLine - 2)
-	{
-		// this should happen rarely or never. Crop the string at 512 and try again.
-		std::string try_again = text.substr(0, ServerInstance->Config->Limits.MaxLine - 2);
-		Write(try_again);
+	Write(MakeLine(text));
+}
+
+reference<SendBuffer> LocalUser::MakeLine(const std::string& text)
+{
+	LineBuilder line;
+	line.Append(text);
+	return line.Finish();
+}
+
+void LocalUser::Write(const reference<SendBuffer>& line)
+{
+	if (!SocketEngine::BoundsCheckFd(&eh))
 		return;
-	}
 
-	ServerInstance->Logs->Log("USEROUTPUT", LOG_RAWIO, "C[%s] O %s", uuid.c_str(), text.c_str());
+	const std::string& data = line->GetData();
+	ServerInstance->Logs->Log("USEROUTPUT", LOG_RAWIO, "C[%s] O %.*s", uuid.c_str(), (int)data.length() - 2, data.c_str());
 
-	eh.AddWriteBuf(text);
-	eh.AddWriteBuf(wide_newline);
+	eh.AddWriteBuf(line);
 
-	ServerInstance->stats.Sent += text.length() + 2;
-	this->bytes_out += text.length() + 2;
+	ServerInstance->stats.Sent += data.length();
+	this->bytes_out += data.length();
 	this->cmds_out++;
 }
 
@@ -790,7 +966,13 @@ void LocalUser::Write(const char *text, ...)
 
 void User::WriteServ(const std::string& text)
 {
-	this->Write(":%s %s",ServerInstance->Config->ServerName.c_str(),text.c_str());
+	LocalUser* const user = IS_LOCAL(this);
+	if (!user)
+		return;
+
+	LineBuilder line(ServerInstance->Config->ServerName);
+	line.Append(text);
+	user->Write(line.Finish());
 }
 
 /** WriteServ()
@@ -805,7 +987,18 @@ void User::WriteServ(const char* text, ...)
 
 void User::WriteCommand(const char* command, const std::string& text)
 {
-	this->WriteServ(command + (this->registered & REG_NICK ? " " + this->nick : " *") + " " + text);
+	LocalUser* const user = IS_LOCAL(this);
+	if (!user)
+		return;
+
+	LineBuilder line(ServerInstance->Config->ServerName);
+	line.Append(command).Append(' ');
+	if (this->registered & REG_NICK)
+		line.Append(this->nick);
+	else
+		line.Append('*');
+	line.Append(' ').Append(text);
+	user->Write(line.Finish());
 }
 
 void User::WriteNumeric(unsigned int numeric, const char* text, ...)
@@ -824,15 +1017,29 @@ void User::WriteNumeric(unsigned int numeric, const std::string &text)
 	if (MOD_RESULT == MOD_RES_DENY)
 		return;
 
-	const std::string message = InspIRCd::Format(":%s %03u %s %s", ServerInstance->Config->ServerName.c_str(),
-		numeric, this->registered & REG_NICK ? this->nick.c_str() : "*", text.c_str());
-	this->Write(message);
+	LocalUser* const user = IS_LOCAL(this);
+	if (!user)
+		return;
+
+	LineBuilder line(ServerInstance->Config->ServerName);
+	line.AppendNumeric(numeric).Append(' ');
+	if (this->registered & REG_NICK)
+		line.Append(this->nick);
+	else
+		line.Append('*');
+	line.Append(' ').Append(text);
+	user->Write(line.Finish());
 }
 
 void User::WriteFrom(User *user, const std::string &text)
 {
-	const std::string message = ":" + user->GetFullHost() + " " + text;
-	this->Write(message);
+	LocalUser* const target = IS_LOCAL(this);
+	if (!target)
+		return;
+
+	LineBuilder line(user->GetFullHost());
+	line.Append(text);
+	target->Write(line.Finish());
 }
 
 
@@ -845,6 +1052,43 @@ void User::WriteFrom(User *user, const char* text, ...)
 	this->WriteFrom(user, textbuffer);
 }
 
+namespace
+{
+	class WriteCommonRawHandler : public User::ForEachNeighborHandler
+	{
+		const reference<SendBuffer> line;
+
+		void Execute(LocalUser* user) CXX11_OVERRIDE
+		{
+			user->Write(line);
+		}
+
+	 public:
+		WriteCommonRawHandler(const reference<SendBuffer>& message)
+			: line(message)
+		{
+		}
+	};
+
+	class WriteCommonQuitHandler : public User::ForEachNeighborHandler
+	{
+		const reference<SendBuffer> normalMessage;
+		const reference<SendBuffer> operMessage;
+
+		void Execute(LocalUser* user) CXX11_OVERRIDE
+		{
+			user->Write(user->IsOper() ? operMessage : normalMessage);
+		}
+
+	 public:
+		WriteCommonQuitHandler(const reference<SendBuffer>& normal, const reference<SendBuffer>& oper)
+			: normalMessage(normal)
+			, operMessage(oper)
+		{
+		}
+	};
+}
+
 void User::WriteCommon(const char* text, ...)
 {
 	if (this->registered != REG_ALL || quitting)
@@ -852,8 +1096,10 @@ void User::WriteCommon(const char* text, ...)
 
 	std::string textbuffer;
 	VAFORMAT(textbuffer, text, text);
-	textbuffer = ":" + this->GetFullHost() + " " + textbuffer;
-	this->WriteCommonRaw(textbuffer, true);
+	LineBuilder line(this->GetFullHost());
+	line.Append(textbuffer);
+	WriteCommonRawHandler handler(line.Finish());
+	ForEachNeighbor(handler, true);
 }
 
 void User::WriteCommonRaw(const std::string &line, bool include_self)
@@ -861,39 +1107,9 @@ void User::WriteCommonRaw(const std::string &line, bool include_self)
 	if (this->registered != REG_ALL || quitting)
 		return;
 
-	LocalUser::already_sent_id++;
-
-	IncludeChanList include_c(chans.begin(), chans.end());
-	std::map<User*,bool> exceptions;
-
-	exceptions[this] = include_self;
-
-	FOREACH_MOD(OnBuildNeighborList, (this, include_c, exceptions));
-
-	for (std::map<User*,bool>::iterator i = exceptions.begin(); i != exceptions.end(); ++i)
-	{
-		LocalUser* u = IS_LOCAL(i->first);
-		if (u && !u->quitting)
-		{
-			u->already_sent = LocalUser::already_sent_id;
-			if (i->second)
-				u->Write(line);
-		}
-	}
-	for (IncludeChanList::const_iterator v = include_c.begin(); v != include_c.end(); ++v)
-	{
-		Channel* c = (*v)->chan;
-		const Channel::MemberMap& ulist = c->GetUsers();
-		for (Channel::MemberMap::const_iterator i = ulist.begin(); i != ulist.end(); ++i)
-		{
-			LocalUser* u = IS_LOCAL(i->first);
-			if (u && u->already_sent != LocalUser::already_sent_id)
-			{
-				u->already_sent = LocalUser::already_sent_id;
-				u->Write(line);
-			}
-		}
-	}
+	// Every neighbour gets the same copy of the line
+	WriteCommonRawHandler handler(LocalUser::MakeLine(line));
+	ForEachNeighbor(handler, include_self);
 }
 
 void User::WriteCommonQuit(const std::string &normal_text, const std::string &oper_text)
@@ -901,39 +1117,56 @@ void User::WriteCommonQuit(const std::string &normal_text, const std::string &op
 	if (this->registered != REG_ALL)
 		return;
 
-	already_sent_t uniq_id = ++LocalUser::already_sent_id;
+	LineBuilder normalline(this->GetFullHost());
+	normalline.Append("QUIT :").Append(normal_text);
+	LineBuilder operline(this->GetFullHost());
+	operline.Append("QUIT :").Append(oper_text);
 
-	const std::string normalMessage = ":" + this->GetFullHost() + " QUIT :" + normal_text;
-	const std::string operMessage = ":" + this->GetFullHost() + " QUIT :" + oper_text;
+	WriteCommonQuitHandler handler(normalline.Finish(), operline.Finish());
+	ForEachNeighbor(handler, false);
+}
 
+already_sent_t User::ForEachNeighbor(ForEachNeighborHandler& handler, bool include_self)
+{
+	// Two users may share more than one channel, so every visited local user is marked by setting
+	// its already_sent field to a new value and users which already have that value are skipped.
+
+	// Modules may remove channels from include_c and add users to exceptions
 	IncludeChanList include_c(chans.begin(), chans.end());
-	std::map<User*,bool> exceptions;
+	NeighborExceptions exceptions;
+	exceptions[this] = include_self;
 
 	FOREACH_MOD(OnBuildNeighborList, (this, include_c, exceptions));
 
-	for (std::map<User*,bool>::iterator i = exceptions.begin(); i != exceptions.end(); ++i)
+	const already_sent_t newid = ++LocalUser::already_sent_id;
+
+	// Mark the excepted users first so they are not visited through a channel
+	for (NeighborExceptions::const_iterator i = exceptions.begin(); i != exceptions.end(); ++i)
 	{
 		LocalUser* u = IS_LOCAL(i->first);
 		if (u && !u->quitting)
 		{
-			u->already_sent = uniq_id;
+			u->already_sent = newid;
 			if (i->second)
-				u->Write(u->IsOper() ? operMessage : normalMessage);
+				handler.Execute(u);
 		}
 	}
+
 	for (IncludeChanList::const_iterator v = include_c.begin(); v != include_c.end(); ++v)
 	{
-		const Channel::MemberMap& ulist = (*v)->chan->GetUsers();
-		for (Channel::MemberMap::const_iterator i = ulist.begin(); i != ulist.end(); i++)
+		const Channel::LocalMemberList& ulist = (*v)->chan->GetLocalUsers();
+		for (Channel::LocalMemberList::const_iterator i = ulist.begin(); i != ulist.end(); ++i)
 		{
-			LocalUser* u = IS_LOCAL(i->first);
-			if (u && (u->already_sent != uniq_id))
+			LocalUser* u = static_cast<LocalUser*>((*i)->user);
+			if (u->already_sent != newid)
 			{
-				u->already_sent = uniq_id;
-				u->Write(u->IsOper() ? operMessage : normalMessage);
+				u->already_sent = newid;
+				handler.Execute(u);
 			}
 		}
 	}
+
+	return newid;
 }
 
 void LocalUser::SendText(const std::string& line)
@@ -981,10 +1214,9 @@ void User::SendText(const std::string& linePrefix, std::stringstream& textStream
  * the first users channels then the second users channels within the outer loop,
  * therefore it was a maximum of x*y iterations (upon returning 0 and checking
  * all possible iterations). However this new function instead checks against the
- * channel's userlist in the inner loop which is a std::map<User*,User*>
- * and saves us time as we already know what pointer value we are after.
- * Don't quote me on the maths as i am not a mathematician or computer scientist,
- * but i believe this algorithm is now x+(log y) maximum iterations instead.
+ * channel's userlist in the inner loop which is a hash map keyed by User*
+ * and saves us time as we already know what pointer value we are after,
+ * so this algorithm is now about x iterations instead.
  */
 bool User::SharesChannelWith(User *other)
 {
@@ -1014,6 +1246,7 @@ bool User::ChangeName(const std::string& gecos)
 		FOREACH_MOD(OnChangeName, (this,gecos));
 	}
 	this->fullname.assign(gecos, 0, ServerInstance->Config->Limits.MaxGecos);
+	identitygeneration++;
 
 	return true;
 }
@@ -1042,6 +1275,17 @@ bool User::ChangeDisplayedHost(const std::string& shost)
 	return true;
 }
 
+void User::ChangeRealHost(const std::string& newhost, bool resetdisplay)
+{
+	this->host.assign(newhost, 0, ServerInstance->Config->Limits.MaxHost);
+	if (resetdisplay)
+		this->dhost = this->host;
+	this->InvalidateCache();
+
+	if (IS_LOCAL(this))
+		ServerInstance->XLines->IndexLocalUser(IS_LOCAL(this));
+}
+
 bool User::ChangeIdent(const std::string& newident)
 {
 	if (this->ident == newident)
@@ -1107,8 +1351,9 @@ void LocalUser::SetClass(const std::string &explicit_name)
 				continue;
 
 			/* check if host matches.. */
-			if (!InspIRCd::MatchCIDR(this->GetIPString(), c->GetHost(), NULL) &&
-			    !InspIRCd::MatchCIDR(this->host, c->GetHost(), NULL))
+			if (!c->hostcidr.match(this->client_sa) &&
+			    !InspIRCd::Match(this->GetIPString(), c->GetHost(), NULL) &&
+			    !InspIRCd::Match(this->host, c->GetHost(), NULL))
 			{
 				ServerInstance->Logs->Log("CONNECTCLASS", LOG_DEBUG, "No host match (for %s)", c->GetHost().c_str());
 				continue;
@@ -1192,6 +1437,7 @@ ConnectClass::ConnectClass(ConfigTag* tag, char t, const std::string& mask)
 	penaltythreshold(0), commandrate(0), maxlocal(0), maxglobal(0), maxconnwarn(true), maxchans(ServerInstance->Config->MaxChans),
 	limit(0), resolvehostnames(true)
 {
+	irc::sockets::ParseCIDR(host.substr(host.rfind('@') + 1), hostcidr);
 }
 
 ConnectClass::ConnectClass(ConfigTag* tag, char t, const std::string& mask, const ConnectClass& parent)
@@ -1202,6 +1448,7 @@ ConnectClass::ConnectClass(ConfigTag* tag, char t, const std::string& mask, cons
 	maxlocal(parent.maxlocal), maxglobal(parent.maxglobal), maxconnwarn(parent.maxconnwarn), maxchans(parent.maxchans),
 	limit(parent.limit), resolvehostnames(parent.resolvehostnames)
 {
+	irc::sockets::ParseCIDR(host.substr(host.rfind('@') + 1), hostcidr);
 }
 
 void ConnectClass::Update(const ConnectClass* src)
@@ -1212,6 +1459,7 @@ void ConnectClass::Update(const ConnectClass* src)
 	name = src->name;
 	registration_timeout = src->registration_timeout;
 	host = src->host;
+	hostcidr = src->hostcidr;
 	pingtime = src->pingtime;
 	softsendqmax = src->softsendqmax;
 	hardsendqmax = src->hardsendqmax;
@@ -71,6 +71,159 @@ static bool MatchInternal(const unsigned char* str, const unsigned char* mask, u
 	return !*wild;
 }
 
+WildcardMask::WildcardMask()
+	: map(national_case_insensitive_map)
+	, national(true)
+	, anchorstart(true)
+	, anchorend(true)
+	, exact(true)
+	, minlen(0)
+{
+	Segment seg = { 0, 0, 0, false };
+	segments.push_back(seg);
+}
+
+WildcardMask::WildcardMask(const std::string& pattern, const unsigned char* casemap)
+	: mask(pattern)
+	, map(casemap ? casemap : national_case_insensitive_map)
+	, national(!casemap)
+	, anchorstart(pattern.empty() || pattern[0] != '*')
+	, anchorend(pattern.empty() || pattern[pattern.length()-1] != '*')
+	, exact(pattern.find('*') == std::string::npos)
+{
+	folded.reserve(pattern.length());
+	Segment seg = { 0, 0, std::string::npos, false };
+	for (std::string::const_iterator i = pattern.begin(); ; ++i)
+	{
+		if ((i == pattern.end()) || (*i == '*'))
+		{
+			seg.len = folded.length() - seg.pos;
+			if (seg.first == std::string::npos)
+				seg.first = seg.len;
+			if ((seg.len) || (exact))
+				segments.push_back(seg);
+
+			if (i == pattern.end())
+				break;
+
+			seg.pos = folded.length();
+			seg.first = std::string::npos;
+			seg.wild = false;
+			continue;
+		}
+
+		if (*i == '?')
+			seg.wild = true;
+		else if (seg.first == std::string::npos)
+			seg.first = folded.length() - seg.pos;
+
+		folded.push_back(*i == '?' ? '?' : map[(unsigned char)*i]);
+	}
+	minlen = folded.length();
+}
+
+bool WildcardMask::MatchSegment(const Segment& seg, const unsigned char* str, const unsigned char* casemap) const
+{
+	const unsigned char* pat = (const unsigned char*)folded.data() + seg.pos;
+	for (std::string::size_type i = 0; i < seg.len; ++i)
+	{
+		if ((casemap[str[i]] != pat[i]) && ((!seg.wild) || (pat[i] != '?')))
+			return false;
+	}
+	return true;
+}
+
+const unsigned char* WildcardMask::FindSegment(const Segment& seg, const unsigned char* str, std::string::size_type len) const
+{
+	if (len < seg.len)
+		return NULL;
+
+	// A segment of only '?' characters matches anywhere
+	if (seg.first == seg.len)
+		return str;
+
+	// Search for the first literal character of the segment with memchr() and compare the rest at each hit
+	const unsigned char* pat = (const unsigned char*)folded.data() + seg.pos;
+	const unsigned char* pos = str + seg.first;
+	const unsigned char* const last = str + (len - seg.len) + seg.first;
+	while (pos <= last)
+	{
+		pos = static_cast<const unsigned char*>(memchr(pos, pat[seg.first], last - pos + 1));
+		if (!pos)
+			return NULL;
+
+		const unsigned char* candidate = pos - seg.first;
+		if (seg.wild ? MatchSegment(seg, candidate, rfc_case_sensitive_map) : !memcmp(candidate, pat, seg.len))
+			return candidate;
+		pos++;
+	}
+	return NULL;
+}
+
+bool WildcardMask::Match(const char* str, std::string::size_type len) const
+{
+	// A module has changed the national case map since this pattern was folded
+	if ((national) && (map != national_case_insensitive_map))
+		return InspIRCd::Match(std::string(str, len), mask, NULL);
+
+	if ((len < minlen) || ((exact) && (len != minlen)))
+		return false;
+
+	const unsigned char* ustr = (const unsigned char*)str;
+	if (exact)
+		return MatchSegment(segments.front(), ustr, map);
+
+	// Check the segments which are anchored to the start and the end of the string first, these need no searching
+	std::vector<Segment>::const_iterator first = segments.begin();
+	std::vector<Segment>::const_iterator last = segments.end();
+	std::string::size_type start = 0;
+	std::string::size_type end = len;
+	if (anchorstart)
+	{
+		if (!MatchSegment(*first, ustr, map))
+			return false;
+		start = first->len;
+		++first;
+	}
+
+	if (anchorend)
+	{
+		--last;
+		end = len - last->len;
+		if (!MatchSegment(*last, ustr + end, map))
+			return false;
+	}
+
+	if (first == last)
+		return true;
+
+	// Fold the part of the string between the anchored segments once, then find the other segments
+	// in it from left to right. Taking the first match of every segment is enough because the segments
+	// are separated by '*'s which can absorb anything between them.
+	unsigned char stackbuf[512];
+	std::vector<unsigned char> heapbuf;
+	unsigned char* buf = stackbuf;
+	const std::string::size_type buflen = end - start;
+	if (buflen > sizeof(stackbuf))
+	{
+		heapbuf.resize(buflen);
+		buf = &heapbuf[0];
+	}
+	for (std::string::size_type i = 0; i < buflen; ++i)
+		buf[i] = map[ustr[start + i]];
+
+	const unsigned char* pos = buf;
+	const unsigned char* const bufend = buf + buflen;
+	for (; first != last; ++first)
+	{
+		pos = FindSegment(*first, pos, bufend - pos);
+		if (!pos)
+			return false;
+		pos += first->len;
+	}
+	return true;
+}
+
 // Below here is all wrappers around MatchInternal
 
 bool InspIRCd::Match(const std::string& str, const std::string& mask, unsigned const char* map)
@@ -103,6 +103,299 @@ class ZLineFactory : public XLineFactory
 };
 
 
+static std::string ToLower(const std::string& str)
+{
+	std::string ret(str);
+	for (std::string::iterator i = ret.begin(); i != ret.end(); ++i)
+		*i = ascii_case_insensitive_map[(unsigned char)*i];
+	return ret;
+}
+
+/** Get the mask a line can be looked up by
+ * @param line The line to get the mask of
+ * @return The host mask of the line if it has no wildcards, NULL if the line can only be found by matching it
+ */
+static const std::string* GetIndexMask(XLine* line)
+{
+	const std::string* mask = line->GetHostMask();
+	if ((!mask) || (mask->find_first_of("*?@") != std::string::npos))
+		return NULL;
+	return mask;
+}
+
+/** Finds the lines of one type which may match a user without calling Matches() on every line.
+ * Lines which have a host mask without wildcards are hashed by the mask, and those with a CIDR
+ * mask are also stored in a binary radix trie. All other lines are kept in a list which has to
+ * be searched linearly. Matches() must still be called on the lines found in the index.
+ */
+class XLineIndex
+{
+	typedef TR1NS::unordered_multimap<std::string, XLine*> HostMap;
+
+	/** Lines with a host mask without wildcards, by the lowercase mask */
+	HostMap hosts;
+
+	/** Lines with a CIDR host mask */
+	insp::cidr_trie<XLine*> addresses;
+
+	/** Lines which cannot be indexed, in no particular order */
+	std::vector<XLine*> wildcards;
+
+	void FindText(const std::string& host, std::vector<XLine*>& out)
+	{
+		std::pair<HostMap::iterator, HostMap::iterator> range = hosts.equal_range(ToLower(host));
+		for (HostMap::iterator i = range.first; i != range.second; ++i)
+			out.push_back(i->second);
+	}
+
+ public:
+	/** Lines which must be checked against every user
+	 */
+	const std::vector<XLine*>& GetWildcards() const { return wildcards; }
+
+	void Add(XLine* line)
+	{
+		const std::string* mask = GetIndexMask(line);
+		if (!mask)
+		{
+			wildcards.push_back(line);
+			return;
+		}
+
+		/* A CIDR mask is also matched as text, so it is hashed too */
+		hosts.insert(std::make_pair(ToLower(*mask), line));
+
+		irc::sockets::cidr_mask cidr;
+		if (irc::sockets::ParseCIDR(*mask, cidr))
+			addresses.insert(cidr, line);
+	}
+
+	void Remove(XLine* line)
+	{
+		const std::string* mask = GetIndexMask(line);
+		if (!mask)
+		{
+			std::vector<XLine*>::iterator i = std::find(wildcards.begin(), wildcards.end(), line);
+			if (i != wildcards.end())
+			{
+				*i = wildcards.back();
+				wildcards.pop_back();
+			}
+			return;
+		}
+
+		std::pair<HostMap::iterator, HostMap::iterator> range = hosts.equal_range(ToLower(*mask));
+		for (HostMap::iterator i = range.first; i != range.second; ++i)
+		{
+			if (i->second == line)
+			{
+				hosts.erase(i);
+				break;
+			}
+		}
+
+		irc::sockets::cidr_mask cidr;
+		if (irc::sockets::ParseCIDR(*mask, cidr))
+			addresses.erase(cidr, line);
+	}
+
+	/** Find the indexed lines which may match a user, not including the wildcard lines
+	 * @param user The user to find lines for
+	 * @param out The lines found are appended to this, a line may be found more than once
+	 */
+	void Find(User* user, std::vector<XLine*>& out)
+	{
+		if (hosts.empty())
+			return;
+
+		const std::string& ip = user->GetIPString();
+		FindText(ip, out);
+		addresses.find(user->client_sa, out);
+
+		if (user->host != ip)
+		{
+			FindText(user->host, out);
+			irc::sockets::sockaddrs sa;
+			if (irc::sockets::aptosa(user->host, 0, sa))
+				addresses.find(sa, out);
+		}
+	}
+
+	/** Find the indexed lines which may match a pattern such as ident\@host, not including the wildcard lines
+	 * @param pattern The pattern to find lines for, only the part after the last \@ is looked up
+	 * @param out The lines found are appended to this, a line may be found more than once
+	 */
+	void Find(const std::string& pattern, std::vector<XLine*>& out)
+	{
+		if (hosts.empty())
+			return;
+
+		const std::string::size_type at = pattern.rfind('@');
+		const std::string host = (at == std::string::npos) ? pattern : pattern.substr(at + 1);
+		FindText(host, out);
+
+		irc::sockets::sockaddrs sa;
+		if (irc::sockets::aptosa(host, 0, sa))
+			addresses.find(sa, out);
+	}
+};
+
+/** The local users, indexed by their host and IP so that the users which a new line with
+ * a host mask without wildcards may match can be found without matching every user.
+ * The index is kept up to date as users connect, quit and change their host or IP.
+ */
+class LocalUserIndex
+{
+	/** An address of a user, compared by family and then by bits */
+	struct Address
+	{
+		unsigned char type;
+		unsigned char bits[16];
+		LocalUser* user;
+
+		bool operator<(const Address& other) const
+		{
+			if (type != other.type)
+				return type < other.type;
+			return memcmp(bits, other.bits, sizeof(bits)) < 0;
+		}
+	};
+
+	typedef TR1NS::unordered_multimap<std::string, LocalUser*> HostMap;
+
+	/** Users by their lowercase host and IP */
+	HostMap hosts;
+
+	/** Users by their IP, and by their host if it is an IP too, sorted so that
+	 * the users in a CIDR range are next to each other
+	 */
+	std::multiset<Address> addresses;
+
+	typedef TR1NS::unordered_map<LocalUser*, std::pair<std::string, std::string> > KeyMap;
+
+	/** The lowercase IP and host each user is indexed by, the host is empty if it is the IP */
+	KeyMap keys;
+
+	static bool MakeAddress(const std::string& key, LocalUser* user, Address& addr)
+	{
+		irc::sockets::sockaddrs sa;
+		if (!irc::sockets::aptosa(key, 0, sa))
+			return false;
+
+		const irc::sockets::cidr_mask cidr(sa, 128);
+		addr.type = cidr.type;
+		memcpy(addr.bits, cidr.bits, sizeof(addr.bits));
+		addr.user = user;
+		return true;
+	}
+
+	void AddKey(const std::string& key, LocalUser* user)
+	{
+		hosts.insert(std::make_pair(key, user));
+
+		Address addr;
+		if (MakeAddress(key, user, addr))
+			addresses.insert(addr);
+	}
+
+	void RemoveKey(const std::string& key, LocalUser* user)
+	{
+		std::pair<HostMap::iterator, HostMap::iterator> range = hosts.equal_range(key);
+		for (HostMap::iterator i = range.first; i != range.second; ++i)
+		{
+			if (i->second == user)
+			{
+				hosts.erase(i);
+				break;
+			}
+		}
+
+		Address addr;
+		if (!MakeAddress(key, user, addr))
+			return;
+
+		std::pair<std::multiset<Address>::iterator, std::multiset<Address>::iterator> arange = addresses.equal_range(addr);
+		for (std::multiset<Address>::iterator i = arange.first; i != arange.second; ++i)
+		{
+			if (i->user == user)
+			{
+				addresses.erase(i);
+				break;
+			}
+		}
+	}
+
+ public:
+	/** Add a user to the index, or update the entry of a user whose host or IP changed
+	 * @param user The user to index
+	 */
+	void Add(LocalUser* user)
+	{
+		const std::string ip = ToLower(user->GetIPString());
+		const std::string host = (user->host == user->GetIPString()) ? std::string() : ToLower(user->host);
+
+		std::pair<KeyMap::iterator, bool> res = keys.insert(std::make_pair(user, std::make_pair(ip, host)));
+		std::pair<std::string, std::string>& entry = res.first->second;
+		if (!res.second)
+		{
+			if ((entry.first == ip) && (entry.second == host))
+				return;
+
+			RemoveKey(entry.first, user);
+			if (!entry.second.empty())
+				RemoveKey(entry.second, user);
+		}
+
+		entry.first = ip;
+		entry.second = host;
+		AddKey(ip, user);
+		if (!host.empty())
+			AddKey(host, user);
+	}
+
+	/** Remove a user from the index
+	 * @param user The user to remove
+	 */
+	void Remove(LocalUser* user)
+	{
+		KeyMap::iterator i = keys.find(user);
+		if (i == keys.end())
+			return;
+
+		RemoveKey(i->second.first, user);
+		if (!i->second.second.empty())
+			RemoveKey(i->second.second, user);
+		keys.erase(i);
+	}
+
+	/** Find the users which a line may match
+	 * @param mask The host mask of the line, without wildcards
+	 * @param out The users found are appended to this, a user may be found more than once
+	 */
+	void Find(const std::string& mask, std::vector<LocalUser*>& out)
+	{
+		std::pair<HostMap::iterator, HostMap::iterator> range = hosts.equal_range(ToLower(mask));
+		for (HostMap::iterator i = range.first; i != range.second; ++i)
+			out.push_back(i->second);
+
+		irc::sockets::cidr_mask cidr;
+		if (!irc::sockets::ParseCIDR(mask, cidr))
+			return;
+
+		/* The addresses in the range go from the prefix followed by zeros to the prefix followed by ones */
+		Address first;
+		first.type = cidr.type;
+		memcpy(first.bits, cidr.bits, sizeof(first.bits));
+		Address last = first;
+		for (unsigned int bit = cidr.length; bit < sizeof(last.bits) * 8; bit++)
+			last.bits[bit / 8] |= 0x80 >> (bit % 8);
+
+		std::multiset<Address>::const_iterator end = addresses.upper_bound(last);
+		for (std::multiset<Address>::const_iterator i = addresses.lower_bound(first); i != end; ++i)
+			out.push_back(i->user);
+	}
+};
+
 /*
  * This is now version 3 of the XLine subsystem, let's see if we can get it as nice and
  * efficient as we can this time so we can close this file and never ever touch it again ..
@@ -125,9 +418,9 @@ class ZLineFactory : public XLineFactory
  *  All lines are (as in v1) stored together -- no seperation of perm and non-perm. They are stored in
  *  a map of maps (first map is line type, second map is for quick lookup on add/delete/etc).
  *
- *  Expiry is *no longer* performed on a timer, and no longer uses a sorted list of any variety. This
- *  is now done by only checking for expiry when a line is accessed, meaning that expiry is no longer
- *  a resource intensive problem.
+ *  Expiry is performed by a timer which ticks when the first line is due to expire. Lines which are
+ *  not permanent are kept in a set sorted by their expiry time, so only the lines which have expired
+ *  are looked at, and matching a user never has to expire anything.
  *
  *  Application no longer tries to apply every single line on every single user - instead, now only lines
  *  added since the previous application are applied. This keeps S2S ADDLINE during burst nice and fast,
@@ -184,20 +477,8 @@ XLineLookup* XLineManager::GetAll(const std::string &type)
 	if (n == lookup_lines.end())
 		return NULL;
 
-	LookupIter safei;
-	const time_t current = ServerInstance->Time();
-
 	/* Expire any dead ones, before sending */
-	for (LookupIter x = n->second.begin(); x != n->second.end(); )
-	{
-		safei = x;
-		safei++;
-		if (x->second->duration && current > x->second->expiry)
-		{
-			ExpireLine(n, x);
-		}
-		x = safei;
-	}
+	ExpireLines();
 
 	return &(n->second);
 }
@@ -282,6 +563,18 @@ bool XLineManager::AddLine(XLine* line, User* user)
 		pending_lines.push_back(line);
 
 	lookup_lines[line->type][line->Displayable().c_str()] = line;
+
+	XLineIndex*& index = line_indexes[line->type];
+	if (!index)
+		index = new XLineIndex;
+	index->Add(line);
+
+	if (line->duration)
+	{
+		expiring_lines.insert(std::make_pair(line->expiry, line));
+		ScheduleExpiry();
+	}
+
 	line->OnAdd();
 
 	FOREACH_MOD(OnAddLine, (user, line));
@@ -313,6 +606,10 @@ bool XLineManager::DelLine(const char* hostmask, const std::string &type, User*
 	y->second->Unset();
 
 	stdalgo::erase(pending_lines, y->second);
+	line_indexes[type]->Remove(y->second);
+	stdalgo::erase(scanning_lines, y->second);
+	if (y->second->duration)
+		expiring_lines.erase(std::make_pair(y->second->expiry, y->second));
 
 	delete y->second;
 	x->second.erase(y);
@@ -334,75 +631,53 @@ void ELine::Unset()
 	ServerInstance->XLines->CheckELines();
 }
 
-// returns a pointer to the reason if a nickname matches a qline, NULL if it didnt match
-
-XLine* XLineManager::MatchesLine(const std::string &type, User* user)
+template <typename T>
+XLine* XLineManager::MatchIndex(ContainerIter container, T subject)
 {
-	ContainerIter x = lookup_lines.find(type);
-
-	if (x == lookup_lines.end())
-		return NULL;
-
+	XLineIndex* index = line_indexes[container->first];
 	const time_t current = ServerInstance->Time();
 
-	LookupIter safei;
+	std::vector<XLine*> candidates;
+	index->Find(subject, candidates);
 
-	for (LookupIter i = x->second.begin(); i != x->second.end(); )
+	/* Lines which have expired but have not been removed by the expiry timer yet are skipped */
+	for (std::vector<XLine*>::const_iterator i = candidates.begin(); i != candidates.end(); ++i)
 	{
-		safei = i;
-		safei++;
-
-		if (i->second->duration && current > i->second->expiry)
-		{
-			/* Expire the line, proceed to next one */
-			ExpireLine(x, i);
-			i = safei;
-			continue;
-		}
-
-		if (i->second->Matches(user))
-		{
-			return i->second;
-		}
+		XLine* line = *i;
+		if ((!line->duration || current <= line->expiry) && line->Matches(subject))
+			return line;
+	}
 
-		i = safei;
+	const std::vector<XLine*>& wildcards = index->GetWildcards();
+	for (std::vector<XLine*>::const_iterator i = wildcards.begin(); i != wildcards.end(); ++i)
+	{
+		XLine* line = *i;
+		if ((!line->duration || current <= line->expiry) && line->Matches(subject))
+			return line;
 	}
 	return NULL;
 }
 
-XLine* XLineManager::MatchesLine(const std::string &type, const std::string &pattern)
+// returns a pointer to the reason if a nickname matches a qline, NULL if it didnt match
+
+XLine* XLineManager::MatchesLine(const std::string &type, User* user)
 {
 	ContainerIter x = lookup_lines.find(type);
 
 	if (x == lookup_lines.end())
 		return NULL;
 
-	const time_t current = ServerInstance->Time();
-
-	 LookupIter safei;
+	return MatchIndex<User*>(x, user);
+}
 
-	for (LookupIter i = x->second.begin(); i != x->second.end(); )
-	{
-		safei = i;
-		safei++;
+XLine* XLineManager::MatchesLine(const std::string &type, const std::string &pattern)
+{
+	ContainerIter x = lookup_lines.find(type);
 
-		if (i->second->Matches(pattern))
-		{
-			if (i->second->duration && current > i->second->expiry)
-			{
-				/* Expire the line, return nothing */
-				ExpireLine(x, i);
-				/* See above */
-				i = safei;
-				continue;
-			}
-			else
-				return i->second;
-		}
+	if (x == lookup_lines.end())
+		return NULL;
 
-		i = safei;
-	}
-	return NULL;
+	return MatchIndex<const std::string&>(x, pattern);
 }
 
 // removes lines that have expired
@@ -418,65 +693,167 @@ void XLineManager::ExpireLine(ContainerIter container, LookupIter item)
 	 * -- Brain
 	 */
 	stdalgo::erase(pending_lines, item->second);
+	line_indexes[container->first]->Remove(item->second);
+	stdalgo::erase(scanning_lines, item->second);
+	if (item->second->duration)
+		expiring_lines.erase(std::make_pair(item->second->expiry, item->second));
 
 	delete item->second;
 	container->second.erase(item);
 }
 
+void XLineManager::ExpireLines()
+{
+	const time_t current = ServerInstance->Time();
+	while (!expiring_lines.empty() && current > expiring_lines.begin()->first)
+	{
+		XLine* line = expiring_lines.begin()->second;
+		ContainerIter x = lookup_lines.find(line->type);
+		ExpireLine(x, x->second.find(line->Displayable().c_str()));
+	}
+}
+
+void XLineManager::ScheduleExpiry()
+{
+	if (expiring_lines.empty())
+		return;
+
+	/* Lines expire in the second after their expiry time */
+	const time_t next = expiring_lines.begin()->first + 1;
+	if (nextexpiry && nextexpiry <= next)
+		return;
+
+	nextexpiry = next;
+	expirytimer.SetInterval(std::max<time_t>(next - ServerInstance->Time(), 0));
+}
+
+bool XLineExpiryTimer::Tick(time_t TIME)
+{
+	manager->nextexpiry = 0;
+	manager->ExpireLines();
+	manager->ScheduleExpiry();
+	return true;
+}
+
+
+/** Maximum number of times Matches() is called on the scanning lines in each main loop iteration */
+static const unsigned int MAX_SCAN_MATCHES = 10000;
 
 // applies lines, removing clients and changing nicks etc as applicable
 void XLineManager::ApplyLines()
 {
-	const UserManager::LocalList& list = ServerInstance->Users.GetLocalUsers();
-	for (UserManager::LocalList::const_iterator j = list.begin(); j != list.end(); ++j)
+	if (!pending_lines.empty())
+		applytimer.SetInterval(0);
+}
+
+void XLineManager::ApplyPendingLines()
+{
+	if (scanning_lines.empty())
+		scanning_users.clear();
+
+	/* Wildcard lines have to wait until the lines which are already being scanned have been applied to every user */
+	const bool scanning = !scanning_lines.empty();
+	std::vector<XLine*> indexed;
+	std::vector<XLine*> waiting;
+	for (std::vector<XLine*>::const_iterator i = pending_lines.begin(); i != pending_lines.end(); ++i)
 	{
-		LocalUser* u = *j;
+		if (GetIndexMask(*i))
+			indexed.push_back(*i);
+		else if (scanning)
+			waiting.push_back(*i);
+		else
+			scanning_lines.push_back(*i);
+	}
+	pending_lines.swap(waiting);
 
-		// Don't ban people who are exempt.
-		if (u->exempt)
-			continue;
+	if (!indexed.empty())
+	{
+		std::vector<LocalUser*> candidates;
+		for (std::vector<XLine*>::const_iterator i = indexed.begin(); i != indexed.end(); ++i)
+		{
+			XLine* x = *i;
+			candidates.clear();
+			localusers->Find(*GetIndexMask(x), candidates);
+			for (std::vector<LocalUser*>::const_iterator j = candidates.begin(); j != candidates.end(); ++j)
+			{
+				LocalUser* u = *j;
+
+				// Don't ban people who are exempt.
+				if (u->exempt || u->quitting)
+					continue;
 
-		for (std::vector<XLine *>::iterator i = pending_lines.begin(); i != pending_lines.end(); i++)
+				if (x->Matches(u))
+					x->Apply(u);
+			}
+		}
+	}
+
+	if (!scanning_lines.empty())
+	{
+		if (!scanning)
 		{
-			XLine *x = *i;
-			if (x->Matches(u))
-				x->Apply(u);
+			const UserManager::LocalList& list = ServerInstance->Users.GetLocalUsers();
+			for (UserManager::LocalList::const_iterator j = list.begin(); j != list.end(); ++j)
+				scanning_users.push_back((*j)->uuid);
 		}
+
+		/* Lines can be deleted while they are applied, so they are looked at by index */
+		for (size_t count = std::max<size_t>(MAX_SCAN_MATCHES / scanning_lines.size(), 1); count && !scanning_users.empty(); count--)
+		{
+			User* user = ServerInstance->FindUUID(scanning_users.back());
+			scanning_users.pop_back();
+
+			// Don't ban people who are exempt.
+			LocalUser* u = user ? IS_LOCAL(user) : NULL;
+			if (!u || u->exempt)
+				continue;
+
+			for (size_t i = 0; (i < scanning_lines.size()) && (!u->quitting); i++)
+			{
+				XLine* x = scanning_lines[i];
+				if (x->Matches(u))
+					x->Apply(u);
+			}
+		}
+
+		if (scanning_users.empty())
+			scanning_lines.clear();
 	}
 
-	pending_lines.clear();
+	// Continue in the next main loop iteration, the timer does not run again in this one
+	if (!pending_lines.empty() || !scanning_lines.empty())
+		applytimer.SetInterval(0);
 }
 
-void XLineManager::InvokeStats(const std::string &type, int numeric, User* user, string_list &results)
+bool XLineApplyTimer::Tick(time_t TIME)
 {
-	ContainerIter n = lookup_lines.find(type);
+	manager->ApplyPendingLines();
+	return true;
+}
 
-	time_t current = ServerInstance->Time();
+void XLineManager::InvokeStats(const std::string &type, int numeric, User* user, string_list &results)
+{
+	ExpireLines();
 
-	LookupIter safei;
+	ContainerIter n = lookup_lines.find(type);
 
 	if (n != lookup_lines.end())
 	{
 		XLineLookup& list = n->second;
-		for (LookupIter i = list.begin(); i != list.end(); )
+		for (LookupIter i = list.begin(); i != list.end(); ++i)
 		{
-			safei = i;
-			safei++;
-
-			if (i->second->duration && current > i->second->expiry)
-			{
-				ExpireLine(n, i);
-			}
-			else
-				results.push_back(ConvToStr(numeric)+" "+user->nick+" :"+i->second->Displayable()+" "+
-					ConvToStr(i->second->set_time)+" "+ConvToStr(i->second->duration)+" "+i->second->source+" :"+i->second->reason);
-			i = safei;
+			results.push_back(ConvToStr(numeric)+" "+user->nick+" :"+i->second->Displayable()+" "+
+				ConvToStr(i->second->set_time)+" "+ConvToStr(i->second->duration)+" "+i->second->source+" :"+i->second->reason);
 		}
 	}
 }
 
 
 XLineManager::XLineManager()
+	: expirytimer(this)
+	, nextexpiry(0)
+	, applytimer(this)
+	, localusers(new LocalUserIndex)
 {
 	GLineFactory* GFact;
 	ELineFactory* EFact;
@@ -515,6 +892,21 @@ XLineManager::~XLineManager()
 			delete j->second;
 		}
 	}
+
+	for (std::map<std::string, XLineIndex*>::iterator i = line_indexes.begin(); i != line_indexes.end(); ++i)
+		delete i->second;
+
+	delete localusers;
+}
+
+void XLineManager::IndexLocalUser(LocalUser* user)
+{
+	localusers->Add(user);
+}
+
+void XLineManager::UnindexLocalUser(LocalUser* user)
+{
+	localusers->Remove(user);
 }
 
 void XLine::Apply(User* u)
@@ -541,8 +933,14 @@ void XLine::DefaultApply(User* u, const std::string &line, bool bancache)
 
 	if (bancache)
 	{
-		ServerInstance->Logs->Log("BANCACHE", LOG_DEBUG, "BanCache: Adding positive hit (" + line + ") for " + u->GetIPString());
-		ServerInstance->BanCache.AddHit(u->GetIPString(), this->type, banReason, this->duration);
+		/* Every address in the range of a CIDR line is banned by it, so the whole range can be cached */
+		irc::sockets::cidr_mask range;
+		const std::string* mask = GetHostMask();
+		if ((!mask) || (!irc::sockets::ParseCIDR(*mask, range)))
+			range = irc::sockets::cidr_mask(u->client_sa, 128);
+
+		ServerInstance->Logs->Log("BANCACHE", LOG_DEBUG, "BanCache: Adding positive hit (" + line + ") for " + range.str());
+		ServerInstance->BanCache.AddHit(range, this->type, banReason, this->duration);
 	}
 }
 
@@ -552,10 +950,9 @@ bool KLine::Matches(User *u)
 	if (lu && lu->exempt)
 		return false;
 
-	if (InspIRCd::Match(u->ident, this->identmask, ascii_case_insensitive_map))
+	if (identmatcher.Match(u->ident))
 	{
-		if (InspIRCd::MatchCIDR(u->host, this->hostmask, ascii_case_insensitive_map) ||
-		    InspIRCd::MatchCIDR(u->GetIPString(), this->hostmask, ascii_case_insensitive_map))
+		if (hostcidr.match(u->client_sa) || hostmatcher.Match(u->host) || hostmatcher.Match(u->GetIPString()))
 		{
 			return true;
 		}
@@ -575,10 +972,9 @@ bool GLine::Matches(User *u)
 	if (lu && lu->exempt)
 		return false;
 
-	if (InspIRCd::Match(u->ident, this->identmask, ascii_case_insensitive_map))
+	if (identmatcher.Match(u->ident))
 	{
-		if (InspIRCd::MatchCIDR(u->host, this->hostmask, ascii_case_insensitive_map) ||
-		    InspIRCd::MatchCIDR(u->GetIPString(), this->hostmask, ascii_case_insensitive_map))
+		if (hostcidr.match(u->client_sa) || hostmatcher.Match(u->host) || hostmatcher.Match(u->GetIPString()))
 		{
 			return true;
 		}
@@ -598,10 +994,9 @@ bool ELine::Matches(User *u)
 	if (lu && lu->exempt)
 		return false;
 
-	if (InspIRCd::Match(u->ident, this->identmask, ascii_case_insensitive_map))
+	if (identmatcher.Match(u->ident))
 	{
-		if (InspIRCd::MatchCIDR(u->host, this->hostmask, ascii_case_insensitive_map) ||
-		    InspIRCd::MatchCIDR(u->GetIPString(), this->hostmask, ascii_case_insensitive_map))
+		if (hostcidr.match(u->client_sa) || hostmatcher.Match(u->host) || hostmatcher.Match(u->GetIPString()))
 		{
 			return true;
 		}
@@ -616,7 +1011,7 @@ bool ZLine::Matches(User *u)
 	if (lu && lu->exempt)
 		return false;
 
-	if (InspIRCd::MatchCIDR(u->GetIPString(), this->ipaddr))
+	if (ipcidr.match(u->client_sa) || ipmatcher.Match(u->GetIPString()))
 		return true;
 	else
 		return false;
@@ -630,7 +1025,7 @@ void ZLine::Apply(User* u)
 
 bool QLine::Matches(User *u)
 {
-	if (InspIRCd::Match(u->nick, this->nick))
+	if (nickmatcher.Match(u->nick))
 		return true;
 
 	return false;
@@ -645,7 +1040,8 @@ void QLine::Apply(User* u)
 
 bool ZLine::Matches(const std::string &str)
 {
-	if (InspIRCd::MatchCIDR(str, this->ipaddr))
+	irc::sockets::sockaddrs sa;
+	if (ipmatcher.Match(str) || ((ipcidr.type != AF_UNSPEC) && (irc::sockets::aptosa(str, 0, sa)) && (ipcidr.match(sa))))
 		return true;
 	else
 		return false;
@@ -653,7 +1049,7 @@ bool ZLine::Matches(const std::string &str)
 
 bool QLine::Matches(const std::string &str)
 {
-	if (InspIRCd::Match(str, this->nick))
+	if (nickmatcher.Match(str))
 		return true;
 
 	return false;
@@ -693,6 +1089,26 @@ void XLine::DisplayExpiry()
 		type.c_str(), (onechar ? "-Line" : ""), Displayable().c_str(), source.c_str(), (long)(ServerInstance->Time() - set_time));
 }
 
+const std::string* ELine::GetHostMask()
+{
+	return &hostmask;
+}
+
+const std::string* KLine::GetHostMask()
+{
+	return &hostmask;
+}
+
+const std::string* GLine::GetHostMask()
+{
+	return &hostmask;
+}
+
+const std::string* ZLine::GetHostMask()
+{
+	return &ipaddr;
+}
+
 const std::string& ELine::Displayable()
 {
 	return matchtext;